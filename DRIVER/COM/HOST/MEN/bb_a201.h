@@ -0,0 +1,40 @@
+/***********************  I n c l u d e  -  F i l e  ************************
+ *
+ *         Name: bb_a201.h
+ *
+ *  Description: A201/B201/B202 board handler interface, host stub
+ *               (host build of the A201 board handler, see host.mak)
+ *
+ *     Switches: B201, B202 - handler variant
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2026, MEN Mikro Elektronik GmbH
+ ******************************************************************************/
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _BB_A201_H
+#define _BB_A201_H
+
+#ifdef B201
+# define __A201_GetEntry	__B201_GetEntry
+#endif
+#ifdef B202
+# define __A201_GetEntry	__B202_GetEntry
+#endif
+
+extern void __A201_GetEntry( BBIS_ENTRY *bbisP );
+
+#endif /* _BB_A201_H */
@@ -0,0 +1,77 @@
+/***********************  I n c l u d e  -  F i l e  ************************
+ *
+ *         Name: bb_defs.h
+ *
+ *  Description: BBIS definitions, host stub
+ *               (host build of the A201 board handler, see host.mak)
+ *
+ *     Switches: -
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2026, MEN Mikro Elektronik GmbH
+ ******************************************************************************/
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _BB_DEFS_H
+#define _BB_DEFS_H
+
+typedef void BBIS_HANDLE;
+
+/* address translation */
+#define BBIS_BUS_TO_LOCAL_NO		0
+#define BBIS_BUS_TO_LOCAL			1
+
+/* irq service results */
+#define BBIS_IRQ_UNK				0x00
+#define BBIS_IRQ_YES				0x01
+#define BBIS_IRQ_NO					0x02
+#define BBIS_IRQ_EXPIRQ				0x04
+
+/* irq types */
+#define BBIS_IRQ_NONE				0x00
+#define BBIS_IRQ_DEVIRQ				0x01
+#define BBIS_IRQ_EXCLUSIVE			0x00
+#define BBIS_IRQ_SHARED				0x02
+
+/* board information */
+#define BBIS_BRDINFO_BUSTYPE		0x01
+#define BBIS_BRDINFO_DEVBUSTYPE		0x02
+#define BBIS_BRDINFO_FUNCTION		0x03
+#define BBIS_BRDINFO_NUM_SLOTS		0x04
+#define BBIS_BRDINFO_INTERRUPTS		0x05
+#define BBIS_BRDINFO_ADDRSPACE		0x06
+#define BBIS_BRDINFO_BRDNAME		0x07
+#define BBIS_BRDINFO_BRDNAME_MAXSIZE	40
+
+#define BBIS_FUNC_IRQENABLE			0x01
+#define BBIS_FUNC_IRQSRVINIT		0x02
+#define BBIS_FUNC_IRQSRVEXIT		0x03
+
+/* configuration information */
+#define BBIS_CFGINFO_BUSNBR			0x01
+#define BBIS_CFGINFO_IRQ			0x02
+#define BBIS_CFGINFO_EXP			0x03
+#define BBIS_CFGINFO_SLOT			0x04
+
+#define BBIS_SLOT_OCCUP_YES			0x01
+#define BBIS_SLOT_OCCUP_NO			0x02
+#define BBIS_SLOT_OCCUP_DIS			0x03
+#define BBIS_SLOT_OCCUP_ALW			0x04
+#define BBIS_SLOT_NBR_UNK			0xffffffff
+#define BBIS_SLOT_STR_UNK			"UNKNOWN"
+#define BBIS_SLOT_STR_MAXSIZE		40
+
+#endif /* _BB_DEFS_H */
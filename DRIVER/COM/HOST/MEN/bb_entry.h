@@ -0,0 +1,74 @@
+/***********************  I n c l u d e  -  F i l e  ************************
+ *
+ *         Name: bb_entry.h
+ *
+ *  Description: BBIS entry point table, host stub
+ *               (host build of the A201 board handler, see host.mak)
+ *
+ *     Switches: -
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2026, MEN Mikro Elektronik GmbH
+ ******************************************************************************/
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _BB_ENTRY_H
+#define _BB_ENTRY_H
+
+typedef struct
+{
+	int32 (*init)( OSS_HANDLE*, DESC_SPEC*, BBIS_HANDLE** );
+	int32 (*brdInit)( BBIS_HANDLE* );
+	int32 (*brdExit)( BBIS_HANDLE* );
+	int32 (*exit)( BBIS_HANDLE** );
+	int32 (*fkt04)( void );
+
+	int32 (*brdInfo)( u_int32, ... );
+	int32 (*cfgInfo)( BBIS_HANDLE*, u_int32, ... );
+	int32 (*fkt07)( void );
+	int32 (*fkt08)( void );
+	int32 (*fkt09)( void );
+
+	int32 (*irqEnable)( BBIS_HANDLE*, u_int32, u_int32 );
+	int32 (*irqSrvInit)( BBIS_HANDLE*, u_int32 );
+	void  (*irqSrvExit)( BBIS_HANDLE*, u_int32 );
+	int32 (*setIrqHandle)( BBIS_HANDLE*, void* );
+	int32 (*fkt14)( void );
+
+	int32 (*expEnable)( BBIS_HANDLE*, u_int32, u_int32 );
+	int32 (*expSrv)( BBIS_HANDLE*, u_int32 );
+	int32 (*fkt17)( void );
+	int32 (*fkt18)( void );
+	int32 (*fkt19)( void );
+
+	int32 (*fkt20)( void );
+	int32 (*fkt21)( void );
+	int32 (*fkt22)( void );
+	int32 (*fkt23)( void );
+	int32 (*fkt24)( void );
+
+	int32 (*setMIface)( BBIS_HANDLE*, u_int32, u_int32, u_int32 );
+	int32 (*getMAddr)( BBIS_HANDLE*, u_int32, u_int32, u_int32, void**,
+					   u_int32* );
+	int32 (*setStat)( BBIS_HANDLE*, u_int32, int32, INT32_OR_64 );
+	int32 (*getStat)( BBIS_HANDLE*, u_int32, int32, INT32_OR_64* );
+
+	int32 (*clrMIface)( BBIS_HANDLE*, u_int32 );
+	int32 (*fkt30)( void );
+	int32 (*fkt31)( void );
+} BBIS_ENTRY;
+
+#endif /* _BB_ENTRY_H */
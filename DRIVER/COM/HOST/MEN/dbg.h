@@ -0,0 +1,63 @@
+/***********************  I n c l u d e  -  F i l e  ************************
+ *
+ *         Name: dbg.h
+ *
+ *  Description: debug output macros, host stub (DBG_Write prints to stderr)
+ *               (host build of the A201 board handler, see host.mak)
+ *
+ *     Switches: -
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2026, MEN Mikro Elektronik GmbH
+ ******************************************************************************/
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _DBG_H
+#define _DBG_H
+
+/* debug levels */
+#define DBG_OFF			0x00000000
+#define DBG_LEV1		0x00000001
+#define DBG_LEV2		0x00000002
+#define DBG_LEV3		0x00000004
+#define DBG_LEVERR		0x00008000
+#define DBG_ALL			0xc000ffff
+
+typedef struct DBG_HANDLE DBG_HANDLE;
+
+extern int32 DBG_Init( char *name, DBG_HANDLE **dbgP );
+extern int32 DBG_Exit( DBG_HANDLE **dbgP );
+extern int32 DBG_Write( DBG_HANDLE *dbg, char *frmt, ... );
+
+#ifdef DBG
+# define DBGCMD(x)		x
+# define DBGINIT(x)		DBG_Init x
+# define DBGEXIT(x)		DBG_Exit x
+# define DBGWRT_1(x)	do { if( DBG_MYLEVEL & DBG_LEV1 ) DBG_Write x; } while(0)
+# define DBGWRT_2(x)	do { if( DBG_MYLEVEL & DBG_LEV2 ) DBG_Write x; } while(0)
+# define DBGWRT_3(x)	do { if( DBG_MYLEVEL & DBG_LEV3 ) DBG_Write x; } while(0)
+# define DBGWRT_ERR(x)	do { if( DBG_MYLEVEL & DBG_LEVERR ) DBG_Write x; } while(0)
+#else
+# define DBGCMD(x)
+# define DBGINIT(x)
+# define DBGEXIT(x)
+# define DBGWRT_1(x)
+# define DBGWRT_2(x)
+# define DBGWRT_3(x)
+# define DBGWRT_ERR(x)
+#endif
+
+#endif /* _DBG_H */
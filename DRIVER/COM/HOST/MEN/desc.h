@@ -0,0 +1,60 @@
+/***********************  I n c l u d e  -  F i l e  ************************
+ *
+ *         Name: desc.h
+ *
+ *  Description: descriptor access, host stub (descriptor = HOST_DESC_KEY table)
+ *               (host build of the A201 board handler, see host.mak)
+ *
+ *     Switches: -
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2026, MEN Mikro Elektronik GmbH
+ ******************************************************************************/
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _DESC_H
+#define _DESC_H
+
+#include "oss.h"
+
+#define DESC_TYPE_U_INT32	1
+#define DESC_TYPE_BINARY	2
+
+/* host descriptor key, a DESC_SPEC is a table terminated by name=NULL */
+typedef struct
+{
+	const char		*name;		/* key name */
+	u_int32			type;		/* DESC_TYPE_xxx */
+	u_int32			val;		/* DESC_TYPE_U_INT32 value */
+	const u_int8	*arr;		/* DESC_TYPE_BINARY data */
+	u_int32			len;		/* DESC_TYPE_BINARY length */
+} HOST_DESC_KEY;
+
+typedef void DESC_SPEC;
+typedef struct DESC_HANDLE DESC_HANDLE;
+
+extern int32 DESC_Init( DESC_SPEC *descSpec, OSS_HANDLE *osHdl,
+						DESC_HANDLE **descHdlP );
+extern int32 DESC_Exit( DESC_HANDLE **descHdlP );
+extern int32 DESC_GetUInt32( DESC_HANDLE *descHdl, u_int32 defVal,
+							 u_int32 *valueP, char *keyFmt, ... );
+extern int32 DESC_GetBinary( DESC_HANDLE *descHdl, u_int8 *defVal,
+							 u_int32 defLen, u_int8 *bufP, u_int32 *lenP,
+							 char *keyFmt, ... );
+extern void DESC_DbgLevelSet( DESC_HANDLE *descHdl, u_int32 dbgLevel );
+extern char* DESC_Ident( void );
+
+#endif /* _DESC_H */
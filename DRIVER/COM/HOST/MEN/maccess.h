@@ -0,0 +1,49 @@
+/***********************  I n c l u d e  -  F i l e  ************************
+ *
+ *         Name: maccess.h
+ *
+ *  Description: memory mapped register access, host stub
+ *               (host build of the A201 board handler, see host.mak)
+ *
+ *     Switches: MAC_BYTESWAP - swap 16/32 bit accesses
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2026, MEN Mikro Elektronik GmbH
+ ******************************************************************************/
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MACCESS_H
+#define _MACCESS_H
+
+#ifdef MAC_BYTESWAP
+# define MAC_SWAP16(w)	((u_int16)(((w) >> 8) | ((w) << 8)))
+# define MAC_SWAP32(l)	( ((u_int32)MAC_SWAP16((u_int16)(l)) << 16) | \
+						  MAC_SWAP16((u_int16)((l) >> 16)) )
+#else
+# define MAC_SWAP16(w)	((u_int16)(w))
+# define MAC_SWAP32(l)	((u_int32)(l))
+#endif
+
+#define MREAD_D16(ma,offs) \
+	MAC_SWAP16( *(volatile u_int16*)((u_int8*)(ma)+(offs)) )
+#define MWRITE_D16(ma,offs,val) \
+	( *(volatile u_int16*)((u_int8*)(ma)+(offs)) = MAC_SWAP16(val) )
+#define MREAD_D32(ma,offs) \
+	MAC_SWAP32( *(volatile u_int32*)((u_int8*)(ma)+(offs)) )
+#define MWRITE_D32(ma,offs,val) \
+	( *(volatile u_int32*)((u_int8*)(ma)+(offs)) = MAC_SWAP32(val) )
+
+#endif /* _MACCESS_H */
@@ -0,0 +1,45 @@
+/***********************  I n c l u d e  -  F i l e  ************************
+ *
+ *         Name: mdis_api.h
+ *
+ *  Description: MDIS API definitions, host stub
+ *               (host build of the A201 board handler, see host.mak)
+ *
+ *     Switches: -
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2026, MEN Mikro Elektronik GmbH
+ ******************************************************************************/
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MDIS_API_H
+#define _MDIS_API_H
+
+/* address/data modes */
+#define MDIS_MA08			0x01
+#define MDIS_MD08			0x01
+#define MDIS_MD16			0x02
+
+/* ident function table */
+typedef struct
+{
+	struct
+	{
+		char *(*identCall)( void );
+	} idCall[8];
+} MDIS_IDENT_FUNCT_TBL;
+
+#endif /* _MDIS_API_H */
@@ -0,0 +1,52 @@
+/***********************  I n c l u d e  -  F i l e  ************************
+ *
+ *         Name: mdis_com.h
+ *
+ *  Description: MDIS common definitions, host stub
+ *               (host build of the A201 board handler, see host.mak)
+ *
+ *     Switches: -
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2026, MEN Mikro Elektronik GmbH
+ ******************************************************************************/
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MDIS_COM_H
+#define _MDIS_COM_H
+
+#include "men_typs.h"
+
+/* scatter/gather block for block SetStat/GetStat */
+typedef struct
+{
+	int32	size;			/* data size in bytes */
+	void	*data;			/* data buffer */
+} M_SG_BLOCK;
+
+/* board handler status code offsets */
+#define M_BRD_OF			0x0d00
+#define M_BRD_BLK_OF		0x0e00
+
+/* common board handler status codes */
+#define M_BB_DEBUG_LEVEL	0x0101
+#define M_BB_IRQ_VECT		0x0102
+#define M_BB_IRQ_LEVEL		0x0103
+#define M_BB_IRQ_PRIORITY	0x0104
+#define M_BB_ID_CHECK		0x0105
+#define M_MK_BLK_REV_ID		0x0f01
+
+#endif /* _MDIS_COM_H */
@@ -0,0 +1,51 @@
+/***********************  I n c l u d e  -  F i l e  ************************
+ *
+ *         Name: mdis_err.h
+ *
+ *  Description: MDIS error codes, host stub
+ *               (host build of the A201 board handler, see host.mak)
+ *
+ *     Switches: -
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2026, MEN Mikro Elektronik GmbH
+ ******************************************************************************/
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MDIS_ERR_H
+#define _MDIS_ERR_H
+
+/* OSS */
+#define ERR_OSS_MEM_ALLOC		0x0100
+#define ERR_OSS_VME_ILL_SPACE	0x0101
+#define ERR_OSS_TIMEOUT			0x0102
+#define ERR_OSS_ILL_PARAM		0x0103
+#define ERR_OSS_MAP_FAILED		0x0104
+
+/* DESC */
+#define ERR_DESC_KEY_NOTFOUND	0x0200
+#define ERR_DESC_BUF_TOOSMALL	0x0201
+
+/* BBIS */
+#define ERR_BBIS_ILL_SLOT		0x0300
+#define ERR_BBIS_UNK_CODE		0x0301
+#define ERR_BBIS_ILL_PARAM		0x0302
+#define ERR_BBIS_ILL_DATAMODE	0x0303
+#define ERR_BBIS_ILL_ADDRMODE	0x0304
+#define ERR_BBIS_ILL_FUNC		0x0305
+#define ERR_BBIS_DESC_PARAM		0x0306
+
+#endif /* _MDIS_ERR_H */
@@ -0,0 +1,62 @@
+/***********************  I n c l u d e  -  F i l e  ************************
+ *
+ *         Name: men_typs.h
+ *
+ *  Description: MEN type definitions, host stub
+ *               (host build of the A201 board handler, see host.mak)
+ *
+ *     Switches: -
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2026, MEN Mikro Elektronik GmbH
+ ******************************************************************************/
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MEN_TYPS_H
+#define _MEN_TYPS_H
+
+#include <stdint.h>
+#include <stdarg.h>
+#include <stddef.h>
+
+typedef uint8_t		u_int8;
+typedef int8_t		int8;
+typedef uint16_t	u_int16;
+typedef int16_t		int16;
+typedef uint32_t	u_int32;
+typedef int32_t		int32;
+typedef uint64_t	u_int64;
+typedef int64_t		int64;
+
+/* pointer sized integers */
+typedef intptr_t	INT32_OR_64;
+typedef uintptr_t	U_INT32_OR_64;
+
+#ifndef TRUE
+# define TRUE		1
+#endif
+#ifndef FALSE
+# define FALSE		0
+#endif
+
+#define ERR_SUCCESS	0
+
+/* ident string helpers */
+#define _MENT_XSTR(s)			#s
+#define MENT_XSTR(s)			_MENT_XSTR(s)
+#define MENT_XSTR_SFX(s,x)		MENT_XSTR(s) #x
+
+#endif /* _MEN_TYPS_H */
@@ -0,0 +1,44 @@
+/***********************  I n c l u d e  -  F i l e  ************************
+ *
+ *         Name: modcom.h
+ *
+ *  Description: M-Module ID-PROM access (id library), host stub
+ *               (host build of the A201 board handler, see host.mak)
+ *
+ *     Switches: ID_SW - swapped variant (id_sw library)
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2026, MEN Mikro Elektronik GmbH
+ ******************************************************************************/
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MODCOM_H
+#define _MODCOM_H
+
+/* module types of m_getmodinfo */
+#define MODCOM_MOD_MEN		1	/* MEN M-Module (magic 0x5346) */
+#define MODCOM_MOD_THIRD	2	/* third party module */
+
+#ifdef ID_SW
+# define m_read			m_read_sw
+# define m_getmodinfo	m_getmodinfo_sw
+#endif
+
+extern u_int16 m_read( U_INT32_OR_64 addr, u_int8 index );
+extern int m_getmodinfo( U_INT32_OR_64 addr, u_int32 *modtype,
+						 u_int32 *devid, u_int32 *devrev, char *devname );
+
+#endif /* _MODCOM_H */
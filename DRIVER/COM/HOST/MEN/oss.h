@@ -0,0 +1,130 @@
+/***********************  I n c l u d e  -  F i l e  ************************
+ *
+ *         Name: oss.h
+ *
+ *  Description: operating system services, host stub
+ *               (host build of the A201 board handler, see host.mak)
+ *
+ *     Switches: -
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2026, MEN Mikro Elektronik GmbH
+ ******************************************************************************/
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _OSS_H
+#define _OSS_H
+
+#include "men_typs.h"
+
+typedef struct OSS_HANDLE OSS_HANDLE;
+typedef struct OSS_ALARM_HANDLE OSS_ALARM_HANDLE;
+typedef struct OSS_SEM_HANDLE OSS_SEM_HANDLE;
+typedef struct OSS_SPINL_HANDLE OSS_SPINL_HANDLE;
+typedef struct OSS_SIG_HANDLE OSS_SIG_HANDLE;
+
+/* resource descriptor for OSS_AssignResources */
+typedef struct
+{
+	int32	type;					/* OSS_RES_xxx */
+	union
+	{
+		struct
+		{
+			void	*physAddr;		/* physical address */
+			u_int32	size;			/* size in bytes */
+		} mem;
+	} u;
+} OSS_RESOURCES;
+
+#define OSS_DBG_DEFAULT			0x0000c003
+
+/* address spaces and bus types */
+#define OSS_ADDRSPACE_MEM		0
+#define OSS_ADDRSPACE_IO		1
+#define OSS_BUSTYPE_NONE		0
+#define OSS_BUSTYPE_VME			1
+#define OSS_BUSTYPE_PCI			2
+#define OSS_BUSTYPE_MMODULE		3
+
+/* VME spaces for OSS_BusToPhysAddr */
+#define OSS_VME_A16				0x0010
+#define OSS_VME_A24				0x0020
+#define OSS_VME_DM_16			0x0100
+#define OSS_VME_DM_32			0x0300
+
+#define OSS_RES_MEM				1
+
+/* semaphores */
+#define OSS_SEM_BIN				0
+#define OSS_SEM_COUNT			1
+#define OSS_SEM_WAITFOREVER		(-1)
+
+extern char* OSS_Ident( void );
+
+/* memory */
+extern void* OSS_MemGet( OSS_HANDLE *oss, u_int32 size, u_int32 *gotsizeP );
+extern int32 OSS_MemFree( OSS_HANDLE *oss, void *addr, u_int32 size );
+extern void OSS_MemFill( OSS_HANDLE *oss, u_int32 size, char *adr, int8 value );
+extern void OSS_MemCopy( OSS_HANDLE *oss, u_int32 size, char *src, char *dest );
+extern int32 OSS_Sprintf( OSS_HANDLE *oss, char *str, const char *fmt, ... );
+
+/* address translation and resources */
+extern int32 OSS_BusToPhysAddr( OSS_HANDLE *oss, int32 busType,
+								void **physicalAddrP, ... );
+extern int32 OSS_MapPhysToVirtAddr( OSS_HANDLE *oss, void *physAddr,
+									u_int32 size, int32 addrSpace,
+									int32 busType, int32 busNbr,
+									void **virtAddrP );
+extern int32 OSS_UnMapVirtAddr( OSS_HANDLE *oss, void **virtAddrP,
+								u_int32 size, int32 addrSpace );
+extern int32 OSS_AssignResources( OSS_HANDLE *oss, int32 busType,
+								  int32 busNbr, int32 resNbr,
+								  OSS_RESOURCES res[] );
+
+/* alarms */
+extern int32 OSS_AlarmCreate( OSS_HANDLE *oss, void (*funct)(void *arg),
+							  void *arg, OSS_ALARM_HANDLE **alarmP );
+extern int32 OSS_AlarmRemove( OSS_HANDLE *oss, OSS_ALARM_HANDLE **alarmP );
+extern int32 OSS_AlarmSet( OSS_HANDLE *oss, OSS_ALARM_HANDLE *alarm,
+						   u_int32 msec, u_int32 cyclic, u_int32 *realMsecP );
+extern int32 OSS_AlarmClear( OSS_HANDLE *oss, OSS_ALARM_HANDLE *alarm );
+
+/* semaphores */
+extern int32 OSS_SemCreate( OSS_HANDLE *oss, int32 semType, int32 initVal,
+							OSS_SEM_HANDLE **semP );
+extern int32 OSS_SemRemove( OSS_HANDLE *oss, OSS_SEM_HANDLE **semP );
+extern int32 OSS_SemWait( OSS_HANDLE *oss, OSS_SEM_HANDLE *sem, int32 msec );
+extern int32 OSS_SemSignal( OSS_HANDLE *oss, OSS_SEM_HANDLE *sem );
+
+/* signals */
+extern int32 OSS_SigCreate( OSS_HANDLE *oss, int32 value,
+							OSS_SIG_HANDLE **sigP );
+extern int32 OSS_SigRemove( OSS_HANDLE *oss, OSS_SIG_HANDLE **sigP );
+extern int32 OSS_SigSend( OSS_HANDLE *oss, OSS_SIG_HANDLE *sig );
+
+/* spin locks (interrupt safe) */
+extern int32 OSS_SpinLockCreate( OSS_HANDLE *oss, OSS_SPINL_HANDLE **spinlP );
+extern int32 OSS_SpinLockRemove( OSS_HANDLE *oss, OSS_SPINL_HANDLE **spinlP );
+extern int32 OSS_SpinLockAcquire( OSS_HANDLE *oss, OSS_SPINL_HANDLE *spinl );
+extern int32 OSS_SpinLockRelease( OSS_HANDLE *oss, OSS_SPINL_HANDLE *spinl );
+
+/* time */
+extern u_int32 OSS_TickGet( OSS_HANDLE *oss );
+extern int32 OSS_TickRateGet( OSS_HANDLE *oss );
+extern int32 OSS_Delay( OSS_HANDLE *oss, int32 msec );
+
+#endif /* _OSS_H */
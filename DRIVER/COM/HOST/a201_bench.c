@@ -0,0 +1,417 @@
+/*********************  P r o g r a m  -  M o d u l e ***********************
+ *
+ *         Name: a201_bench.c
+ *      Project: A201/B201/B202 board handler (host build)
+ *
+ *  Description: Benchmarks the board handler entries against the model
+ *
+ *               Calls every BBIS entry of the handler in a loop, for a set
+ *               of descriptor configurations, and prints per call:
+ *                 host    host CPU time (ns, loop overhead subtracted)
+ *                 bus     simulated bus time of the model (ns)
+ *                 acc     control register + ID-PROM accesses (model)
+ *                 alloc   memory allocations, mappings, alarms (model)
+ *                 calls/regAcc/allocs of the handler's own A201_BLK_PERF
+ *                 counters for the measured entry (regAcc/allocs include
+ *                 the second entry of paired calls, e.g. setMIface+clr)
+ *
+ *     Required: bb_a201.c (with A201_CTRL_HOOK, A201_PERF_CNT),
+ *               a201_model.c, host stubs
+ *     Switches: A201/B201/B202 - handler variant
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2026, MEN Mikro Elektronik GmbH
+ ******************************************************************************/
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <MEN/men_typs.h>
+#include <MEN/oss.h>
+#include <MEN/desc.h>
+#include <MEN/mdis_err.h>
+#include <MEN/mdis_api.h>
+#include <MEN/mdis_com.h>
+#include <MEN/bb_defs.h>
+#include <MEN/bb_entry.h>
+#include <MEN/bb_a201.h>
+#include <MEN/bb_a201_codes.h>
+#include "a201_model.h"
+
+#ifndef A201_PERF_CNT
+# error "a201_bench requires A201_PERF_CNT"
+#endif
+
+/*-----------------------------------------+
+|  DEFINES                                 |
++------------------------------------------*/
+#define LOOPS_DEF		2000		/* iterations per entry */
+#define NO_PERF			(-1)		/* entry has no handler counters */
+
+/*-----------------------------------------+
+|  TYPEDEFS                                |
++------------------------------------------*/
+/* one benchmarked entry */
+typedef struct
+{
+	const char	*name;
+	int			perfIdx;		/* A201_PERF_xxx or NO_PERF */
+	int			perfIdx2;		/* second entry of the call or NO_PERF */
+	void		(*fkt)( void );	/* one call */
+	void		(*pre)( void );	/* setup (not measured) or NULL */
+	void		(*post)( void );/* cleanup (not measured) or NULL */
+} BENCH_OP;
+
+/* descriptor configuration */
+typedef struct
+{
+	const char	*name;
+	u_int32		mapWhole;		/* MAP_WHOLE_BOARD */
+	u_int32		mapLazy;		/* MAP_LAZY */
+	u_int32		pendChk;		/* IRQ_PENDING_CHECK (all slots) */
+} BENCH_CFG;
+
+/*-----------------------------------------+
+|  GLOBALS                                 |
++------------------------------------------*/
+static BBIS_ENTRY	G_bb;
+static BBIS_HANDLE	*G_brdHdl;
+static OSS_HANDLE	*G_osHdl;
+static u_int32		G_nSlots;
+static u_int32		G_loops = LOOPS_DEF;
+static HOST_DESC_KEY *G_desc;
+static u_int8		G_vect[A201M_SLOTS]	 = { 0x80, 0x81, 0x82, 0x83 };
+static u_int8		G_level[A201M_SLOTS] = { 3, 3, 4, 4 };
+static u_int8		G_pendChk[A201M_SLOTS];
+static int			G_errors;
+
+static const BENCH_CFG G_cfg[] = {
+	{ "default", 0, 0, 0 },
+	{ "whole",	 1, 0, 0 },
+	{ "lazy",	 0, 1, 0 },
+	{ "pendchk", 0, 0, 1 },
+};
+
+/*-----------------------------------------+
+|  PROTOTYPES                              |
++------------------------------------------*/
+static void OpNone( void );
+static void SlotOpen( void );
+static void SlotClose( void );
+static void OpInitExit( void );
+static void OpBrdInitExit( void );
+static void OpMIface( void );
+static void OpGetMAddr( void );
+static void OpIrqEnable( void );
+static void OpIrqSrv( void );
+static void OpSetStat( void );
+static void OpGetStat( void );
+static void OpSlotOccupied( void );
+static void OpCfgInfo( void );
+static void OpCfgInfoUncached( void );
+static u_int64 NsNow( void );
+static void Run( const BENCH_OP *op, u_int64 overheadNs );
+
+static const BENCH_OP G_op[] = {
+	{ "init+exit",		  NO_PERF,			   NO_PERF,
+	  OpInitExit,		  NULL,		NULL },
+	{ "brdInit+brdExit",  A201_PERF_BRDINIT,   A201_PERF_BRDEXIT,
+	  OpBrdInitExit,	  NULL,		NULL },
+	{ "setMIface+clr",	  A201_PERF_SETMIFACE, A201_PERF_CLRMIFACE,
+	  OpMIface,			  NULL,		NULL },
+	{ "getMAddr",		  A201_PERF_GETMADDR,  NO_PERF,
+	  OpGetMAddr,		  NULL,		NULL },
+	{ "irqEnable off/on", A201_PERF_IRQENABLE, NO_PERF,
+	  OpIrqEnable,		  SlotOpen, SlotClose },
+	{ "irqSrvInit+Exit",  A201_PERF_IRQSRVINIT, A201_PERF_IRQSRVEXIT,
+	  OpIrqSrv,			  SlotOpen, SlotClose },
+	{ "setStat",		  A201_PERF_SETSTAT,   NO_PERF,
+	  OpSetStat,		  NULL,		NULL },
+	{ "getStat",		  A201_PERF_GETSTAT,   NO_PERF,
+	  OpGetStat,		  NULL,		NULL },
+	{ "getStat occupied", A201_PERF_GETSTAT,   NO_PERF,
+	  OpSlotOccupied,	  NULL,		NULL },
+	{ "cfgInfo cached",	  A201_PERF_CFGINFO,   NO_PERF,
+	  OpCfgInfo,		  NULL,		NULL },
+	{ "cfgInfo uncached", A201_PERF_CFGINFO,   A201_PERF_SETSTAT,
+	  OpCfgInfoUncached,  NULL,		NULL },
+};
+
+/********************************** main ************************************
+ *
+ *  Description:  Program main function
+ *
+ *                usage: a201_bench [loops]
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  argc, argv
+ *  Output.....:  return	0 | 1 on errors
+ *  Globals....:  -
+ ****************************************************************************/
+int main( int argc, char *argv[] )
+{
+	u_int32		c, i, slot;
+	u_int64		t0, overheadNs;
+	void		(*volatile none)( void ) = OpNone;
+	HOST_DESC_KEY desc[] = {
+		{ "PHYS_ADDR",		   DESC_TYPE_U_INT32, A201M_PHYS_ADDR, NULL, 0 },
+		{ "IRQ_VECTOR",		   DESC_TYPE_BINARY,  0, G_vect,	0 },
+		{ "IRQ_LEVEL",		   DESC_TYPE_BINARY,  0, G_level,	0 },
+		{ "IRQ_PENDING_CHECK", DESC_TYPE_BINARY,  0, G_pendChk, 0 },
+		{ "MAP_WHOLE_BOARD",   DESC_TYPE_U_INT32, 0, NULL,		0 },
+		{ "MAP_LAZY",		   DESC_TYPE_U_INT32, 0, NULL,		0 },
+		{ NULL, 0, 0, NULL, 0 }
+	};
+
+	if( argc > 1 )
+		G_loops = strtoul( argv[1], NULL, 0 );
+	if( G_loops == 0 )
+		G_loops = 1;
+
+	G_osHdl = HostOssInit();
+	G_desc	= desc;
+	A201M_Init( NULL );
+	A201M_ModPlug( 0, 0x24, 0x0109, 0x1400 );
+
+	__A201_GetEntry( &G_bb );
+	G_bb.brdInfo( BBIS_BRDINFO_NUM_SLOTS, &G_nSlots );
+	desc[1].len = desc[2].len = desc[3].len = G_nSlots;
+
+	/* loop overhead of the indirect call */
+	t0 = NsNow();
+	for( i=0; i<G_loops; i++ )
+		none();
+	overheadNs = (NsNow() - t0) / G_loops;
+
+	printf( "%u loops/entry, loop overhead %lluns\n", G_loops,
+			(unsigned long long)overheadNs );
+
+	for( c=0; c<sizeof(G_cfg)/sizeof(*G_cfg); c++ ){
+		desc[4].val = G_cfg[c].mapWhole;
+		desc[5].val = G_cfg[c].mapLazy;
+		for( slot=0; slot<A201M_SLOTS; slot++ )
+			G_pendChk[slot] = (u_int8)G_cfg[c].pendChk;
+
+		printf( "--- config %s\n", G_cfg[c].name );
+		printf( "  %-18s %9s %9s %7s %7s | %7s %7s %7s\n", "entry", "host ns",
+				"bus ns", "acc", "alloc", "calls", "regAcc", "allocs" );
+
+		if( G_bb.init( G_osHdl, desc, &G_brdHdl ) ||
+			G_bb.brdInit( G_brdHdl ) ){
+			printf( "*** init failed\n" );
+			return 1;
+		}
+
+		for( i=0; i<sizeof(G_op)/sizeof(*G_op); i++ )
+			Run( &G_op[i], overheadNs );
+
+		G_bb.brdExit( G_brdHdl );
+		G_bb.exit( &G_brdHdl );
+		if( HostOssMemInUse() != 0 ){
+			printf( "*** memory leak: %u bytes\n", HostOssMemInUse() );
+			G_errors++;
+		}
+	}
+
+	return G_errors ? 1 : 0;
+}
+
+/*********************************** Run ************************************
+ *
+ *  Description:  Runs and reports one entry
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  op			entry
+ *				  overheadNs	loop overhead per call
+ *  Output.....:  -
+ *  Globals....:  -
+ ****************************************************************************/
+static void Run( const BENCH_OP *op, u_int64 overheadNs )
+{
+	A201M_STATS	st;
+	A201_PERF	perf;
+	M_SG_BLOCK	blk;
+	u_int64		t0, hostNs;
+	u_int32		i, acc, alloc, calls, regAcc, allocs;
+	double		n = G_loops;
+
+	if( op->pre )
+		op->pre();
+	G_bb.setStat( G_brdHdl, 0, A201_PERF_RESET, 0 );
+	A201M_StatsReset();
+
+	t0 = NsNow();
+	for( i=0; i<G_loops; i++ )
+		op->fkt();
+	hostNs = (NsNow() - t0) / G_loops;
+	hostNs = hostNs > overheadNs ? hostNs - overheadNs : 0;
+
+	A201M_StatsGet( &st );
+	acc	  = st.d16Rd + st.d16Wr + st.d32Wr + st.idpromWords;
+	alloc = st.memGets + st.maps + st.alarms + st.sems;
+
+	printf( "  %-18s %9llu %9.0f %7.2f %7.2f", op->name,
+			(unsigned long long)hostNs, st.busNs / n, acc / n, alloc / n );
+
+	if( op->perfIdx == NO_PERF ){
+		printf( " | %7s %7s %7s\n", "-", "-", "-" );
+		if( op->post )
+			op->post();
+		return;
+	}
+
+	blk.size = sizeof(perf);
+	blk.data = &perf;
+	if( G_bb.getStat( G_brdHdl, 0, A201_BLK_PERF, (INT32_OR_64*)&blk ) ){
+		printf( " | *** A201_BLK_PERF failed\n" );
+		G_errors++;
+		if( op->post )
+			op->post();
+		return;
+	}
+	if( op->post )
+		op->post();
+
+	calls  = perf.calls[op->perfIdx];
+	regAcc = perf.regAcc[op->perfIdx];
+	allocs = perf.allocs[op->perfIdx];
+	if( op->perfIdx2 != NO_PERF ){
+		regAcc += perf.regAcc[op->perfIdx2];
+		allocs += perf.allocs[op->perfIdx2];
+	}
+	printf( " | %7.2f %7.2f %7.2f\n", calls / n, regAcc / n, allocs / n );
+}
+
+/*********************************** NsNow **********************************
+ *
+ *  Description:  Returns the host CPU time (ns)
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  -
+ *  Output.....:  return	ns
+ *  Globals....:  -
+ ****************************************************************************/
+static u_int64 NsNow( void )
+{
+	struct timespec	ts;
+
+	clock_gettime( CLOCK_MONOTONIC, &ts );
+	return (u_int64)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*-----------------------------------------+
+|  benchmarked entries (slot 0)            |
++------------------------------------------*/
+static void OpNone( void )
+{
+	/* empty: loop overhead */
+	__asm__ __volatile__( "" );
+}
+
+static void SlotOpen( void )
+{
+	G_bb.setMIface( G_brdHdl, 0, MDIS_MA08, MDIS_MD16 );
+	G_bb.irqEnable( G_brdHdl, 0, TRUE );
+}
+
+static void SlotClose( void )
+{
+	G_bb.irqEnable( G_brdHdl, 0, FALSE );
+	G_bb.clrMIface( G_brdHdl, 0 );
+}
+
+static void OpInitExit( void )
+{
+	BBIS_HANDLE	*hdl;
+
+	if( G_bb.init( G_osHdl, G_desc, &hdl ) == 0 )
+		G_bb.exit( &hdl );
+	else
+		G_errors++;
+}
+
+static void OpBrdInitExit( void )
+{
+	G_bb.brdInit( G_brdHdl );
+	G_bb.brdExit( G_brdHdl );
+}
+
+static void OpMIface( void )
+{
+	if( G_bb.setMIface( G_brdHdl, 0, MDIS_MA08, MDIS_MD16 ) )
+		G_errors++;
+	G_bb.clrMIface( G_brdHdl, 0 );
+}
+
+static void OpGetMAddr( void )
+{
+	void	*addr;
+	u_int32	size;
+
+	G_bb.getMAddr( G_brdHdl, 0, MDIS_MA08, MDIS_MD16, &addr, &size );
+}
+
+static void OpIrqEnable( void )
+{
+	G_bb.irqEnable( G_brdHdl, 0, FALSE );
+	G_bb.irqEnable( G_brdHdl, 0, TRUE );
+}
+
+static void OpIrqSrv( void )
+{
+	A201M_IrqSet( 0, TRUE );
+	G_bb.irqSrvInit( G_brdHdl, 0 );
+	A201M_IrqSet( 0, FALSE );
+	G_bb.irqSrvExit( G_brdHdl, 0 );
+}
+
+static void OpSetStat( void )
+{
+	G_bb.setStat( G_brdHdl, 0, M_BB_DEBUG_LEVEL, 0 );
+}
+
+static void OpGetStat( void )
+{
+	INT32_OR_64	val;
+
+	G_bb.getStat( G_brdHdl, 0, M_BB_IRQ_VECT, &val );
+}
+
+static void OpSlotOccupied( void )
+{
+	INT32_OR_64	val;
+
+	G_bb.getStat( G_brdHdl, 0, A201_SLOT_OCCUPIED, &val );
+}
+
+static void OpCfgInfo( void )
+{
+	u_int32	occupied, devId, devRev;
+	char	slotName[BBIS_SLOT_STR_MAXSIZE];
+	char	devName[BBIS_SLOT_STR_MAXSIZE];
+
+	G_bb.cfgInfo( G_brdHdl, BBIS_CFGINFO_SLOT, 0, &occupied, &devId, &devRev,
+				  slotName, devName );
+}
+
+static void OpCfgInfoUncached( void )
+{
+	G_bb.setStat( G_brdHdl, 0, A201_PNP_INVALIDATE, 0 );
+	OpCfgInfo();
+}
@@ -0,0 +1,697 @@
+/*********************  P r o g r a m  -  M o d u l e ***********************
+ *
+ *         Name: a201_host.c
+ *      Project: A201/B201/B202 board handler (host build)
+ *
+ *  Description: Runs the board handler against the carrier model
+ *
+ *               Plugs M-Modules into the model, initializes the handler
+ *               through its BBIS entry table, lists the slots with
+ *               BBIS_CFGINFO_SLOT and sets up/clears every slot interface.
+ *               The results are checked against the model; the exit code
+ *               is 0 if all checks pass. Register accesses and simulated
+ *               bus time are printed per step.
+ *
+ *     Required: bb_a201.c (with A201_CTRL_HOOK, A201_HRTIME), a201_model.c,
+ *               host stubs
+ *     Switches: A201/B201/B202 - handler variant
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2026, MEN Mikro Elektronik GmbH
+ ******************************************************************************/
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <MEN/men_typs.h>
+#include <MEN/oss.h>
+#include <MEN/desc.h>
+#include <MEN/mdis_err.h>
+#include <MEN/mdis_api.h>
+#include <MEN/mdis_com.h>
+#include <MEN/bb_defs.h>
+#include <MEN/bb_entry.h>
+#include <MEN/bb_a201.h>
+#include <MEN/bb_a201_codes.h>
+#include "a201_model.h"
+
+extern void A201_CtrlHookWrite( void *ctrlAddr, u_int32 offs, u_int16 val );
+
+/*-----------------------------------------+
+|  DEFINES                                 |
++------------------------------------------*/
+#define POLL_SIG		40			/* poll signal of slot 0 (+slot) */
+
+#define CHECK(expr) \
+	do { if( !(expr) ){ \
+		printf( "*** check failed (line %d): %s\n", __LINE__, #expr ); \
+		G_errors++; } } while(0)
+
+/*-----------------------------------------+
+|  GLOBALS                                 |
++------------------------------------------*/
+static int			G_errors;
+static u_int32		G_polled;			/* poll signals received */
+static u_int32		G_order[8];			/* slots in signal order */
+static u_int32		G_orderCnt;
+static int32		G_retrigger = -1;	/* slot PollSig raises once */
+static u_int8		G_vect[A201M_SLOTS]	 = { 0x80, 0x81, 0x82, 0x83 };
+static u_int8		G_level[A201M_SLOTS] = { 3, 3, 4, 4 };
+
+/* module ids plugged into the slots (0=empty) */
+static const u_int16 G_modId[A201M_SLOTS] = { 0x24, 0x00, 0x3e, 0x00 };
+
+/*-----------------------------------------+
+|  PROTOTYPES                              |
++------------------------------------------*/
+static void Stats( const char *step );
+static void PollSig( int32 value );
+
+/********************************** main ************************************
+ *
+ *  Description:  Program main function
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  -
+ *  Output.....:  return	0 | 1 on failed checks
+ *  Globals....:  -
+ ****************************************************************************/
+int main( void )
+{
+	OSS_HANDLE	*osHdl = HostOssInit();
+	BBIS_ENTRY	bb;
+	BBIS_HANDLE	*brdHdl;
+	u_int32		nSlots, slot, occupied, devId, devRev;
+	char		slotName[BBIS_SLOT_STR_MAXSIZE];
+	char		devName[BBIS_SLOT_STR_MAXSIZE];
+	int32		error;
+	HOST_DESC_KEY desc[] = {
+		{ "PHYS_ADDR",	 DESC_TYPE_U_INT32, A201M_PHYS_ADDR, NULL, 0 },
+		{ "IRQ_VECTOR",	 DESC_TYPE_BINARY,	0, G_vect,  0 },
+		{ "IRQ_LEVEL",	 DESC_TYPE_BINARY,	0, G_level, 0 },
+		{ "IRQ_STORM_LIMIT",   DESC_TYPE_U_INT32, 3,  NULL, 0 },
+		{ "IRQ_STORM_HOLDOFF", DESC_TYPE_U_INT32, 20, NULL, 0 },
+		{ "IRQ_PRIO_DISPATCH", DESC_TYPE_U_INT32, 2,  NULL, 0 },
+		{ NULL, 0, 0, NULL, 0 }
+	};
+
+	A201M_Init( NULL );
+	for( slot=0; slot<A201M_SLOTS; slot++ )
+		if( G_modId[slot] )
+			A201M_ModPlug( slot, G_modId[slot], 0x0109, 0x1400 );
+
+	__A201_GetEntry( &bb );
+	bb.brdInfo( BBIS_BRDINFO_NUM_SLOTS, &nSlots );
+	desc[1].len = desc[2].len = nSlots;
+
+	/*------------------------------+
+	| invalid A201_CONFIG record    |
+	+------------------------------*/
+	{
+		u_int8			rec[A201_CFG_SIZE(A201M_SLOTS)];
+		u_int32			len = A201_CFG_SIZE(nSlots);
+		HOST_DESC_KEY	cfgDesc[] = {
+			{ "PHYS_ADDR",	 DESC_TYPE_U_INT32, A201M_PHYS_ADDR, NULL, 0 },
+			{ "A201_CONFIG", DESC_TYPE_BINARY,	0, rec, 4 },
+			{ NULL, 0, 0, NULL, 0 }
+		};
+
+		/* present but invalid: no fallback to the single keys */
+		memset( rec, 0, sizeof(rec) );
+		rec[0] = A201_CFG_MAGIC >> 8;
+		rec[1] = A201_CFG_MAGIC & 0xff;
+		rec[2] = A201_CFG_VERSION;
+		rec[3] = (u_int8)nSlots;
+		rec[4] = (u_int8)(len >> 8);
+		rec[5] = (u_int8)len;
+		CHECK( bb.init( osHdl, cfgDesc, &brdHdl ) == ERR_BBIS_DESC_PARAM );
+
+		/* right length, bad checksum */
+		cfgDesc[1].len = len;
+		rec[6] = rec[7] = 0xff;
+		CHECK( bb.init( osHdl, cfgDesc, &brdHdl ) == ERR_BBIS_DESC_PARAM );
+		CHECK( HostOssMemInUse() == 0 );
+	}
+
+	/*------------------------------+
+	| init                          |
+	+------------------------------*/
+	error = bb.init( osHdl, desc, &brdHdl );
+	CHECK( error == 0 );
+	if( error )
+		return 1;
+	CHECK( bb.brdInit( brdHdl ) == 0 );
+	Stats( "init" );
+
+	/*------------------------------+
+	| ID-PROM prefetch              |
+	+------------------------------*/
+	{
+		A201M_STATS		st;
+
+		/* A201_BrdInit only starts the tasks */
+		A201M_StatsGet( &st );
+		CHECK( st.idpromWords == 0 );
+		CHECK( bb.setStat( brdHdl, 0, A201_PNP_WAIT, 0 ) == ERR_OSS_TIMEOUT );
+
+		/* slot 0 gets used meanwhile: waits for the pass (bounded) */
+		CHECK( bb.setMIface( brdHdl, 0, MDIS_MA08, MDIS_MD16 ) == 0 );
+		CHECK( bb.setStat( brdHdl, 0, A201_PNP_WAIT, 0 ) == 0 );
+		A201M_StatsGet( &st );
+		CHECK( st.idpromWords != 0 );
+		CHECK( bb.clrMIface( brdHdl, 0 ) == 0 );
+		Stats( "prefetch" );
+
+		/* all slots are cached */
+		for( slot=0; slot<nSlots; slot++ ){
+			bb.cfgInfo( brdHdl, BBIS_CFGINFO_SLOT, slot, &occupied,
+						&devId, &devRev, slotName, devName );
+			A201M_StatsGet( &st );
+			CHECK( st.idpromWords == 0 );
+		}
+		CHECK( bb.setStat( brdHdl, 0, A201_PNP_WAIT, -1 ) == 0 );
+	}
+
+	/*------------------------------+
+	| slot inventory                |
+	+------------------------------*/
+	for( slot=0; slot<nSlots; slot++ ){
+		error = bb.cfgInfo( brdHdl, BBIS_CFGINFO_SLOT, slot, &occupied,
+							&devId, &devRev, slotName, devName );
+		printf( "%-16s %s 0x%08x 0x%08x %s\n", slotName,
+				occupied == BBIS_SLOT_OCCUP_YES ? "occupied" : "empty   ",
+				devId, devRev, devName );
+
+		CHECK( error == 0 );
+		if( G_modId[slot] ){
+			CHECK( occupied == BBIS_SLOT_OCCUP_YES );
+			CHECK( devId == (0x53460000 | G_modId[slot]) );
+			CHECK( devRev == 0x01091400 );
+		}
+		else
+			CHECK( occupied == BBIS_SLOT_OCCUP_NO );
+	}
+	Stats( "cfginfo" );
+
+	/* cached */
+	for( slot=0; slot<nSlots; slot++ )
+		bb.cfgInfo( brdHdl, BBIS_CFGINFO_SLOT, slot, &occupied,
+					&devId, &devRev, slotName, devName );
+	Stats( "cfginfo cached" );
+
+	/* PnP scan: a probe task per slot, the inventory waits for the pass */
+	{
+		u_int32			nbr = A201M_SLOTS;
+		A201_SLOT_INFO	inv[A201M_SLOTS];
+		A201M_STATS		st;
+
+		CHECK( bb.setStat( brdHdl, 0, A201_PNP_SCAN, 0 ) == 0 );
+		A201M_StatsGet( &st );
+		CHECK( st.idpromWords == 0 );
+		CHECK( bb.cfgInfo( brdHdl, A201_CFGINFO_SLOT_ALL, &nbr, inv ) == 0 );
+		A201M_StatsGet( &st );
+		CHECK( st.idpromWords != 0 );
+		CHECK( nbr == nSlots );
+		for( slot=0; slot<nSlots; slot++ ){
+			CHECK( inv[slot].occupied == (G_modId[slot] ?
+				   BBIS_SLOT_OCCUP_YES : BBIS_SLOT_OCCUP_NO) );
+			if( G_modId[slot] )
+				CHECK( inv[slot].devId == (0x53460000 | G_modId[slot]) );
+		}
+	}
+	Stats( "pnp scan" );
+
+	/* occupancy poll keeps the full information */
+	{
+		INT32_OR_64		occ = 0;
+		A201M_STATS		st;
+
+		CHECK( bb.getStat( brdHdl, 0, A201_SLOT_OCCUPIED, &occ ) == 0 );
+		CHECK( occ == BBIS_SLOT_OCCUP_YES );
+		A201M_StatsReset();
+		bb.cfgInfo( brdHdl, BBIS_CFGINFO_SLOT, 0, &occupied,
+					&devId, &devRev, slotName, devName );
+		A201M_StatsGet( &st );
+		CHECK( st.idpromWords == 0 );
+		CHECK( devId == (0x53460000 | G_modId[0]) );
+		CHECK( devRev == 0x01091400 );
+
+		/* slot in use: answered without bus access */
+		CHECK( bb.setMIface( brdHdl, 0, MDIS_MA08, MDIS_MD16 ) == 0 );
+		A201M_StatsReset();
+		CHECK( bb.getStat( brdHdl, 0, A201_SLOT_OCCUPIED, &occ ) == 0 );
+		A201M_StatsGet( &st );
+		CHECK( occ == BBIS_SLOT_OCCUP_YES );
+		CHECK( st.d16Rd == 0 && st.idpromWords == 0 && st.maps == 0 );
+		CHECK( bb.clrMIface( brdHdl, 0 ) == 0 );
+	}
+	Stats( "occupied" );
+
+	/*------------------------------+
+	| slot interface, irq enable    |
+	+------------------------------*/
+	for( slot=0; slot<nSlots; slot++ ){
+		CHECK( bb.setMIface( brdHdl, slot, MDIS_MA08, MDIS_MD16 ) == 0 );
+		CHECK( bb.irqEnable( brdHdl, slot, TRUE ) == 0 );
+		CHECK( A201M_CtrlGet( slot ) == (0x10 | G_level[slot]) );
+		CHECK( A201M_VectGet( slot ) == G_vect[slot] );
+		CHECK( bb.irqEnable( brdHdl, slot, FALSE ) == 0 );
+		CHECK( !(A201M_CtrlGet( slot ) & A201M_CTRL_ENABLE) );
+		CHECK( bb.clrMIface( brdHdl, slot ) == 0 );
+	}
+	Stats( "miface" );
+
+	/*------------------------------+
+	| irq enable by slot mask       |
+	+------------------------------*/
+	{
+		u_int32		last = nSlots - 1;
+		u_int32		mask = 0x1 | (1 << last);
+
+		CHECK( bb.setMIface( brdHdl, 0, MDIS_MA08, MDIS_MD16 ) == 0 );
+		if( last ){
+			/* last slot not set up: no slot changes */
+			CHECK( bb.setStat( brdHdl, 0, A201_IRQ_ENABLE_MASK,
+							   A201_IRQ_ENABLE_MASK_VAL( mask, 0xff ) ) ==
+				   ERR_BBIS_ILL_PARAM );
+			CHECK( !(A201M_CtrlGet( 0 ) & A201M_CTRL_ENABLE) );
+			CHECK( bb.setMIface( brdHdl, last, MDIS_MA08, MDIS_MD16 ) == 0 );
+		}
+		CHECK( bb.setStat( brdHdl, 0, A201_IRQ_ENABLE_MASK,
+						   A201_IRQ_ENABLE_MASK_VAL( 1 << nSlots, 0xff ) ) ==
+			   ERR_BBIS_ILL_PARAM );
+
+		CHECK( bb.setStat( brdHdl, 0, A201_IRQ_ENABLE_MASK,
+						   A201_IRQ_ENABLE_MASK_VAL( mask, 0xff ) ) == 0 );
+		CHECK( A201M_CtrlGet( 0 ) == (0x10 | G_level[0]) );
+		CHECK( A201M_CtrlGet( last ) == (0x10 | G_level[last]) );
+		CHECK( bb.setStat( brdHdl, 0, A201_IRQ_ENABLE_MASK,
+						   A201_IRQ_ENABLE_MASK_VAL( mask, 0x00 ) ) == 0 );
+		CHECK( !(A201M_CtrlGet( 0 ) & A201M_CTRL_ENABLE) );
+		CHECK( !(A201M_CtrlGet( last ) & A201M_CTRL_ENABLE) );
+		CHECK( bb.clrMIface( brdHdl, 0 ) == 0 );
+		if( last )
+			CHECK( bb.clrMIface( brdHdl, last ) == 0 );
+		Stats( "irq enable mask" );
+	}
+
+	/*------------------------------+
+	| irq vector/level reprogram    |
+	+------------------------------*/
+	{
+		u_int32		mask;
+
+		/* open slot with irq enabled: changed in place */
+		CHECK( bb.setMIface( brdHdl, 0, MDIS_MA08, MDIS_MD16 ) == 0 );
+		CHECK( bb.irqEnable( brdHdl, 0, TRUE ) == 0 );
+		CHECK( bb.setStat( brdHdl, 0, M_BB_IRQ_VECT, 0x90 ) == 0 );
+		CHECK( bb.setStat( brdHdl, 0, M_BB_IRQ_LEVEL, 5 ) == 0 );
+		CHECK( A201M_CtrlGet( 0 ) == (0x10 | 5) );
+		CHECK( A201M_VectGet( 0 ) == 0x90 );
+		CHECK( bb.cfgInfo( brdHdl, A201_CFGINFO_VECT_SLOTS, 0x90,
+						   &mask ) == 0 && mask == 0x1 );
+		CHECK( bb.setStat( brdHdl, 0, M_BB_IRQ_LEVEL, 8 ) ==
+			   ERR_BBIS_ILL_PARAM );
+
+		/* open slot with irq disabled: stays disabled */
+		CHECK( bb.irqEnable( brdHdl, 0, FALSE ) == 0 );
+		CHECK( bb.setStat( brdHdl, 0, M_BB_IRQ_VECT, G_vect[0] ) == 0 );
+		CHECK( bb.setStat( brdHdl, 0, M_BB_IRQ_LEVEL, G_level[0] ) == 0 );
+		CHECK( A201M_CtrlGet( 0 ) == G_level[0] );
+		CHECK( A201M_VectGet( 0 ) == G_vect[0] );
+		CHECK( bb.clrMIface( brdHdl, 0 ) == 0 );
+		CHECK( bb.cfgInfo( brdHdl, A201_CFGINFO_VECT_SLOTS, 0x90,
+						   &mask ) == 0 && mask == 0 );
+	}
+	Stats( "reprogram" );
+
+	/*------------------------------+
+	| irq service, histograms, storm|
+	+------------------------------*/
+	{
+		INT32_OR_64		srvTime;
+		A201_IRQ_HIST	hist;
+		M_SG_BLOCK		blk;
+		u_int32			i, n;
+
+		CHECK( bb.setMIface( brdHdl, 0, MDIS_MA08, MDIS_MD16 ) == 0 );
+		CHECK( bb.irqEnable( brdHdl, 0, TRUE ) == 0 );
+		A201M_IrqSet( 0, TRUE );
+		bb.irqSrvInit( brdHdl, 0 );
+		A201M_IrqSet( 0, FALSE );
+		bb.irqSrvExit( brdHdl, 0 );
+		CHECK( bb.getStat( brdHdl, 0, A201_IRQ_SRVTIME, &srvTime ) == 0 );
+
+		blk.size = sizeof(hist);
+		blk.data = &hist;
+		CHECK( bb.getStat( brdHdl, 0, A201_BLK_IRQ_HIST,
+						   (INT32_OR_64*)&blk ) == 0 );
+		for( i=0, n=0; i<A201_HIST_BUCKETS; i++ )
+			n += hist.enaDelay[i];
+		CHECK( n == 1 );
+		CHECK( hist.stampHz == 1000000000 );
+
+		/* storm: masked after 3 irqs within the window, then restored */
+		for( i=0; i<4; i++ ){
+			A201M_IrqSet( 0, TRUE );
+			bb.irqSrvInit( brdHdl, 0 );
+			A201M_IrqSet( 0, FALSE );
+			bb.irqSrvExit( brdHdl, 0 );
+		}
+		CHECK( !(A201M_CtrlGet( 0 ) & A201M_CTRL_ENABLE) );
+		HostOssAdvance( 21 );
+		CHECK( A201M_CtrlGet( 0 ) & A201M_CTRL_ENABLE );
+		CHECK( bb.irqEnable( brdHdl, 0, FALSE ) == 0 );
+		CHECK( bb.clrMIface( brdHdl, 0 ) == 0 );
+		printf( "  srvTime slot 0: %dns\n", (int)srvTime );
+		Stats( "irq service" );
+	}
+
+	/*------------------------------+
+	| irq trace                     |
+	+------------------------------*/
+	{
+		struct {
+			A201_TRACE_HDR		hdr;
+			A201_TRACE_ENTRY	ent[A201_TRACE_SIZE];
+		} trc;
+		M_SG_BLOCK		blk;
+		u_int32			i;
+
+		CHECK( bb.setMIface( brdHdl, 0, MDIS_MA08, MDIS_MD16 ) == 0 );
+		CHECK( bb.irqEnable( brdHdl, 0, TRUE ) == 0 );
+		blk.data = &trc;
+		blk.size = sizeof(trc);
+		CHECK( bb.getStat( brdHdl, 0, A201_BLK_IRQ_TRACE,
+						   (INT32_OR_64*)&blk ) == 0 );
+
+		/* 2 entries per irq, one irq per storm window: 16 too many */
+		for( i=0; i<A201_TRACE_SIZE/2 + 8; i++ ){
+			HostOssAdvance( 11 );
+			A201M_IrqSet( 0, TRUE );
+			bb.irqSrvInit( brdHdl, 0 );
+			A201M_IrqSet( 0, FALSE );
+			bb.irqSrvExit( brdHdl, 0 );
+		}
+		blk.size = sizeof(trc);
+		CHECK( bb.getStat( brdHdl, 0, A201_BLK_IRQ_TRACE,
+						   (INT32_OR_64*)&blk ) == 0 );
+		/* a full ring also gives up the entry the irq path writes next */
+		CHECK( trc.hdr.lost >= 16 );
+		CHECK( trc.hdr.lost + trc.hdr.count == A201_TRACE_SIZE + 16 );
+		CHECK( blk.size == (int32)(sizeof(trc.hdr) +
+								   trc.hdr.count * sizeof(trc.ent[0])) );
+
+		/* lost count is reset by the drain */
+		blk.size = sizeof(trc);
+		CHECK( bb.getStat( brdHdl, 0, A201_BLK_IRQ_TRACE,
+						   (INT32_OR_64*)&blk ) == 0 );
+		CHECK( trc.hdr.lost == 0 && trc.hdr.count == 0 );
+		blk.size = sizeof(trc.hdr) - 1;
+		CHECK( bb.getStat( brdHdl, 0, A201_BLK_IRQ_TRACE,
+						   (INT32_OR_64*)&blk ) == ERR_BBIS_ILL_PARAM );
+
+		CHECK( bb.irqEnable( brdHdl, 0, FALSE ) == 0 );
+		CHECK( bb.clrMIface( brdHdl, 0 ) == 0 );
+		Stats( "irq trace" );
+	}
+
+	/*------------------------------+
+	| polled mode                   |
+	+------------------------------*/
+	{
+		int32	sig;
+
+		HostOssSigHook( PollSig );
+
+		/* signal needs the slot interface, polling needs the signal */
+		CHECK( bb.setStat( brdHdl, 0, A201_IRQ_POLL_SIG, POLL_SIG ) ==
+			   ERR_BBIS_ILL_PARAM );
+		CHECK( bb.setMIface( brdHdl, 0, MDIS_MA08, MDIS_MD16 ) == 0 );
+		CHECK( bb.irqEnable( brdHdl, 0, TRUE ) == 0 );
+		CHECK( bb.setStat( brdHdl, 0, A201_IRQ_POLL, 1 ) ==
+			   ERR_BBIS_ILL_PARAM );
+		CHECK( bb.setStat( brdHdl, 0, A201_IRQ_POLL_SIG, -1 ) ==
+			   ERR_BBIS_ILL_PARAM );
+		CHECK( bb.setStat( brdHdl, 0, A201_IRQ_POLL_SIG, POLL_SIG ) == 0 );
+		CHECK( bb.getStat( brdHdl, 0, A201_IRQ_POLL_SIG,
+						   (INT32_OR_64*)&sig ) == 0 && sig == POLL_SIG );
+		CHECK( bb.setStat( brdHdl, 0, A201_IRQ_POLL, 1 ) == 0 );
+		CHECK( !(A201M_CtrlGet( 0 ) & A201M_CTRL_ENABLE) );
+
+		A201M_IrqSet( 0, TRUE );
+		HostOssAdvance( 2 );
+		CHECK( G_polled == 1 );
+
+		/* signal removed: back to interrupt mode, installed again */
+		CHECK( bb.setStat( brdHdl, 0, A201_IRQ_POLL_SIG, 0 ) == 0 );
+		CHECK( A201M_CtrlGet( 0 ) & A201M_CTRL_ENABLE );
+		CHECK( bb.setStat( brdHdl, 0, A201_IRQ_POLL_SIG, POLL_SIG ) == 0 );
+		CHECK( !(A201M_CtrlGet( 0 ) & A201M_CTRL_ENABLE) );
+
+		/* released slot: signal gone, no more polls */
+		CHECK( bb.clrMIface( brdHdl, 0 ) == 0 );
+		CHECK( bb.getStat( brdHdl, 0, A201_IRQ_POLL_SIG,
+						   (INT32_OR_64*)&sig ) == 0 && sig == 0 );
+		A201M_IrqSet( 0, TRUE );
+		HostOssAdvance( 5 );
+		A201M_IrqSet( 0, FALSE );
+		CHECK( G_polled == 1 );
+		CHECK( bb.setMIface( brdHdl, 0, MDIS_MA08, MDIS_MD16 ) == 0 );
+		CHECK( bb.setStat( brdHdl, 0, A201_IRQ_POLL, 1 ) ==
+			   ERR_BBIS_ILL_PARAM );
+		CHECK( bb.clrMIface( brdHdl, 0 ) == 0 );
+		Stats( "polled" );
+	}
+
+	/*------------------------------+
+	| adaptive irq/poll switching   |
+	+------------------------------*/
+	{
+		INT32_OR_64	poll;
+		u_int32		i;
+
+		G_polled = 0;
+		CHECK( bb.setMIface( brdHdl, 0, MDIS_MA08, MDIS_MD16 ) == 0 );
+		CHECK( bb.irqEnable( brdHdl, 0, TRUE ) == 0 );
+		CHECK( bb.setStat( brdHdl, 0, A201_IRQ_POLL_SIG, POLL_SIG ) == 0 );
+		CHECK( bb.setStat( brdHdl, 0, A201_IRQ_ADAPT_LOW, 1 ) == 0 );
+		CHECK( bb.setStat( brdHdl, 0, A201_IRQ_ADAPT_HIGH, 2 ) == 0 );
+		CHECK( bb.setStat( brdHdl, 0, A201_IRQ_ADAPTIVE, 1 ) == 0 );
+
+		/* 3 irqs in the window (apart for the storm check): polled */
+		for( i=0; i<3; i++ ){
+			A201M_IrqSet( 0, TRUE );
+			bb.irqSrvInit( brdHdl, 0 );
+			A201M_IrqSet( 0, FALSE );
+			bb.irqSrvExit( brdHdl, 0 );
+			HostOssAdvance( 20 );
+		}
+		HostOssAdvance( 50 );
+		CHECK( bb.getStat( brdHdl, 0, A201_IRQ_POLL, &poll ) == 0 &&
+			   poll == 1 );
+		CHECK( !(A201M_CtrlGet( 0 ) & A201M_CTRL_ENABLE) );
+
+		/* the alarm kept running through the switch */
+		A201M_IrqSet( 0, TRUE );
+		HostOssAdvance( 2 );
+		CHECK( G_polled == 1 );
+
+		/* a window without hits: interrupt driven again */
+		HostOssAdvance( 200 );
+		CHECK( bb.getStat( brdHdl, 0, A201_IRQ_POLL, &poll ) == 0 &&
+			   poll == 0 );
+		CHECK( A201M_CtrlGet( 0 ) & A201M_CTRL_ENABLE );
+
+		CHECK( bb.setStat( brdHdl, 0, A201_IRQ_ADAPTIVE, 0 ) == 0 );
+		CHECK( bb.irqEnable( brdHdl, 0, FALSE ) == 0 );
+		CHECK( bb.clrMIface( brdHdl, 0 ) == 0 );
+		Stats( "adaptive" );
+	}
+
+	/*------------------------------+
+	| priority dispatch (polled)    |
+	+------------------------------*/
+	if( nSlots > 1 ){
+		u_int32	last = nSlots - 1;
+
+		G_orderCnt = 0;
+		for( slot=0; slot<nSlots; slot += last ){
+			CHECK( bb.setMIface( brdHdl, slot, MDIS_MA08, MDIS_MD16 ) == 0 );
+			CHECK( bb.setStat( brdHdl, slot, A201_IRQ_POLL_SIG,
+							   POLL_SIG + slot ) == 0 );
+			CHECK( bb.setStat( brdHdl, slot, A201_IRQ_POLL, 1 ) == 0 );
+		}
+		CHECK( bb.setStat( brdHdl, 0, M_BB_IRQ_PRIORITY, 1 ) == 0 );
+		CHECK( bb.setStat( brdHdl, last, M_BB_IRQ_PRIORITY, 5 ) == 0 );
+
+		/* higher priority first, and again when raised meanwhile */
+		G_retrigger = last;
+		A201M_IrqSet( 0, TRUE );
+		A201M_IrqSet( last, TRUE );
+		HostOssAdvance( 1 );
+		CHECK( G_orderCnt == 3 && G_order[0] == last && G_order[1] == 0 &&
+			   G_order[2] == last );
+
+		for( slot=0; slot<nSlots; slot += last ){
+			CHECK( bb.setStat( brdHdl, slot, M_BB_IRQ_PRIORITY, 0 ) == 0 );
+			CHECK( bb.clrMIface( brdHdl, slot ) == 0 );
+		}
+		Stats( "prio dispatch" );
+	}
+
+	/*------------------------------+
+	| A08 window claims             |
+	+------------------------------*/
+	{
+		A201_MAP_REGION	reg;
+		A201_A08_INFO	ai;
+		M_SG_BLOCK		blk;
+		int				devA, devB;		/* OS layer device handles */
+
+		CHECK( bb.cfgInfo( brdHdl, A201_CFGINFO_A08_CLAIM, 0, &devA,
+						   &reg ) == ERR_BBIS_ILL_PARAM );
+		CHECK( bb.setMIface( brdHdl, 0, MDIS_MA08, MDIS_MD16 ) == 0 );
+		CHECK( bb.cfgInfo( brdHdl, A201_CFGINFO_A08_CLAIM, 0, &devA,
+						   &reg ) == 0 );
+		CHECK( reg.addr == (void*)(U_INT32_OR_64)A201M_PHYS_ADDR &&
+			   reg.size == 0x100 );
+		CHECK( bb.cfgInfo( brdHdl, A201_CFGINFO_A08_CLAIM, 0, &devB,
+						   &reg ) == ERR_BBIS_ILL_PARAM );
+		CHECK( bb.cfgInfo( brdHdl, A201_CFGINFO_A08_RELEASE, 0, &devB ) ==
+			   ERR_BBIS_ILL_PARAM );
+		blk.size = sizeof(ai);
+		blk.data = &ai;
+		CHECK( bb.getStat( brdHdl, 0, A201_BLK_A08_INFO,
+						   (INT32_OR_64*)&blk ) == 0 && ai.mapCnt == 1 );
+		/* leftover claim is dropped with the slot interface */
+		CHECK( bb.clrMIface( brdHdl, 0 ) == 0 );
+		CHECK( bb.setMIface( brdHdl, 0, MDIS_MA08, MDIS_MD16 ) == 0 );
+		CHECK( bb.cfgInfo( brdHdl, A201_CFGINFO_A08_CLAIM, 0, &devB,
+						   &reg ) == 0 );
+		CHECK( bb.cfgInfo( brdHdl, A201_CFGINFO_A08_RELEASE, 0, &devB ) ==
+			   0 );
+		CHECK( bb.clrMIface( brdHdl, 0 ) == 0 );
+		Stats( "a08 claim" );
+	}
+
+	/*------------------------------+
+	| user space mapping info       |
+	+------------------------------*/
+	{
+		A201_MAP_INFO	mi;
+		A201_MAP_REGION	reg;
+		M_SG_BLOCK		blk;
+		A201_STATUS_PAGE *status;
+
+		blk.size = sizeof(mi);
+		blk.data = &mi;
+		CHECK( bb.getStat( brdHdl, 0, A201_BLK_MAP_INFO,
+						   (INT32_OR_64*)&blk ) == 0 );
+		CHECK( mi.ctrlOffs == A201_MAP_OFFS_CTRL );
+		CHECK( mi.ctrlSize == 4 );
+		CHECK( mi.ctrlStride == A201_MAP_CTRL_STRIDE );
+		CHECK( mi.statusOffs == A201_MAP_OFFS_STATUS );
+		CHECK( mi.statusSize >= sizeof(A201_STATUS_PAGE) &&
+			   (mi.statusSize & 0xfff) == 0 );
+
+		/* the OS layer maps the regions */
+		CHECK( bb.cfgInfo( brdHdl, A201_CFGINFO_MAP_OPEN, 0x1234, &reg ) ==
+			   ERR_BBIS_ILL_PARAM );
+		CHECK( bb.cfgInfo( brdHdl, A201_CFGINFO_MAP_OPEN, mi.statusOffs,
+						   &reg ) == 0 );
+		status = (A201_STATUS_PAGE*)reg.addr;
+		CHECK( reg.readOnly && reg.size == mi.statusSize );
+		CHECK( ((U_INT32_OR_64)status & 0xfff) == 0 );
+		CHECK( status->nbrOfSlots == nSlots );
+		CHECK( bb.setMIface( brdHdl, 0, MDIS_MA08, MDIS_MD16 ) == 0 );
+		CHECK( bb.irqEnable( brdHdl, 0, TRUE ) == 0 );
+		CHECK( status->slot[0].irqEnabled && !(status->seq & 1) );
+		CHECK( bb.irqEnable( brdHdl, 0, FALSE ) == 0 );
+		CHECK( bb.clrMIface( brdHdl, 0 ) == 0 );
+
+		/* control registers: one slot per page, refused with 4k pages */
+		for( slot=0; slot<nSlots; slot++ )
+			CHECK( bb.cfgInfo( brdHdl, A201_CFGINFO_MAP_OPEN,
+							   mi.ctrlOffs + slot * mi.ctrlStride, &reg ) ==
+				   ERR_BBIS_ILL_FUNC );
+		CHECK( bb.cfgInfo( brdHdl, A201_CFGINFO_MAP_OPEN,
+						   A201_MAP_OFFS_CTRL_SLOT(nSlots), &reg ) ==
+			   ERR_BBIS_ILL_PARAM );
+		CHECK( bb.cfgInfo( brdHdl, A201_CFGINFO_MAP_CLOSE, mi.ctrlOffs ) ==
+			   ERR_BBIS_ILL_PARAM );
+		CHECK( bb.cfgInfo( brdHdl, A201_CFGINFO_MAP_CLOSE, mi.statusOffs ) ==
+			   0 );
+		Stats( "map info" );
+	}
+
+	/*------------------------------+
+	| cleanup                       |
+	+------------------------------*/
+	CHECK( bb.brdExit( brdHdl ) == 0 );
+	CHECK( bb.exit( &brdHdl ) == 0 );
+	Stats( "exit" );
+	CHECK( HostOssMemInUse() == 0 );
+
+	printf( "%s\n", G_errors ? "FAILED" : "OK" );
+	return G_errors ? 1 : 0;
+}
+
+/*********************************** Stats **********************************
+ *
+ *  Description:  Prints and clears the model counters
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  step		step name
+ *  Output.....:  -
+ *  Globals....:  -
+ ****************************************************************************/
+static void Stats( const char *step )
+{
+	A201M_STATS	st;
+
+	A201M_StatsGet( &st );
+	printf( "  %-16s rd=%u wr=%u wr32=%u idprom=%u map=%u/%u bus=%lluns\n",
+			step, st.d16Rd, st.d16Wr, st.d32Wr, st.idpromWords, st.maps,
+			st.unmaps, (unsigned long long)st.busNs );
+	A201M_StatsReset();
+}
+
+/********************************** PollSig *********************************
+ *
+ *  Description:  Poll signal receiver: counts and logs the slot, releases
+ *                the model irq, raises the irq of G_retrigger once
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  value		signal number (POLL_SIG + slot)
+ *  Output.....:  -
+ *  Globals....:  G_polled, G_order, G_orderCnt, G_retrigger
+ ****************************************************************************/
+static void PollSig( int32 value )
+{
+	u_int32	mSlot = value - POLL_SIG;
+
+	G_polled++;
+	if( G_orderCnt < 8 )
+		G_order[G_orderCnt++] = mSlot;
+	A201M_IrqSet( mSlot, FALSE );
+
+	if( G_retrigger >= 0 && (u_int32)G_retrigger != mSlot ){
+		A201M_IrqSet( G_retrigger, TRUE );
+		G_retrigger = -1;
+	}
+}
@@ -0,0 +1,534 @@
+/*********************  P r o g r a m  -  M o d u l e ***********************
+ *
+ *         Name: a201_model.c
+ *      Project: A201/B201/B202 board handler (host build)
+ *
+ *  Description: Software model of the A201 carrier for the host build
+ *
+ *               The model provides the board address space (A201M_SIZE at
+ *               A201M_PHYS_ADDR) for OSS_MapPhysToVirtAddr, the control/
+ *               vector registers of the slots for the A201_CTRL_HOOK
+ *               functions and the M-Module ID-PROMs for m_read/
+ *               m_getmodinfo. Every access is counted and charged to a
+ *               simulated bus time (A201M_COST); the defaults can be
+ *               overridden with the environment variables A201M_D16_NS,
+ *               A201M_D32_NS, A201M_IDPROM_ACC and A201M_MAP_NS.
+ *
+ *               The ID-PROM layout of the model is: word 0 magic (0x5346),
+ *               word 1 module id, word 2 layout revision, word 3 product
+ *               variant. m_getmodinfo reads all A201M_IDPROM_WORDS words
+ *               (as the id library does for the checksum), m_read one word.
+ *
+ *     Required: -
+ *     Switches: -
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2026, MEN Mikro Elektronik GmbH
+ ******************************************************************************/
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <MEN/men_typs.h>
+#include <MEN/oss.h>
+#include <MEN/modcom.h>
+#include "a201_model.h"
+
+/*-----------------------------------------+
+|  DEFINES                                 |
++------------------------------------------*/
+#define CTRL_OFFS			0x100	/* control register in the slot block */
+#define SLOT_STRIDE			0x200	/* slot block size */
+#define IDPROM_MAGIC		0x5346
+
+/*-----------------------------------------+
+|  TYPEDEFS                                |
++------------------------------------------*/
+typedef struct
+{
+	u_int16	ctrl;						/* control register */
+	u_int16	vect;						/* vector register */
+	u_int32	pending;					/* module requests irq */
+	u_int32	present;					/* module plugged */
+	u_int16	idprom[A201M_IDPROM_WORDS];	/* ID-PROM contents */
+} SLOT;
+
+/*-----------------------------------------+
+|  GLOBALS                                 |
++------------------------------------------*/
+static u_int64		G_mem[A201M_SIZE / sizeof(u_int64)];	/* address space */
+static SLOT			G_slot[A201M_SLOTS];
+static A201M_COST	G_cost = { 800, 900, 100, 20000 };
+static A201M_STATS	G_stats;
+static u_int64		G_busTime;		/* simulated bus time, never reset */
+
+/*-----------------------------------------+
+|  PROTOTYPES                              |
++------------------------------------------*/
+static SLOT *SlotOf( void *addr, u_int32 offs );
+static u_int32 EnvGet( const char *name, u_int32 defVal );
+static void BusTime( u_int64 ns );
+
+/*
+ * the handler is linked against these (A201_CTRL_HOOK)
+ */
+extern void    A201_CtrlHookWrite( void *ctrlAddr, u_int32 offs, u_int16 val );
+extern u_int16 A201_CtrlHookRead( void *ctrlAddr, u_int32 offs );
+extern void    A201_CtrlHookWrite32( void *ctrlAddr, u_int32 offs, u_int32 val );
+extern u_int16 m_read_sw( U_INT32_OR_64 addr, u_int8 index );
+extern int m_getmodinfo_sw( U_INT32_OR_64 addr, u_int32 *modtype,
+							u_int32 *devid, u_int32 *devrev, char *devname );
+extern u_int32 A201_HrStamp( void );
+extern u_int32 A201_HrStampHz( void );
+
+/********************************* A201M_Init *******************************
+ *
+ *  Description:  Resets the model: empty slots, registers cleared,
+ *                counters cleared
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  cost		bus cost model or NULL (defaults/environment)
+ *  Output.....:  -
+ *  Globals....:  G_mem, G_slot, G_cost, G_stats
+ ****************************************************************************/
+void A201M_Init( const A201M_COST *cost )
+{
+	memset( G_mem, 0, sizeof(G_mem) );
+	memset( G_slot, 0, sizeof(G_slot) );
+	memset( &G_stats, 0, sizeof(G_stats) );
+
+	if( cost ){
+		G_cost = *cost;
+	}
+	else {
+		G_cost.d16Ns	 = EnvGet( "A201M_D16_NS", G_cost.d16Ns );
+		G_cost.d32Ns	 = EnvGet( "A201M_D32_NS", G_cost.d32Ns );
+		G_cost.idpromAcc = EnvGet( "A201M_IDPROM_ACC", G_cost.idpromAcc );
+		G_cost.mapNs	 = EnvGet( "A201M_MAP_NS", G_cost.mapNs );
+	}
+}
+
+/******************************* A201M_ModPlug ******************************
+ *
+ *  Description:  Plugs a MEN M-Module into a slot
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  slot		slot 0..A201M_SLOTS-1
+ *                modId		module id (ID-PROM word 1)
+ *                layoutRev	layout revision (word 2)
+ *                variant	product variant (word 3)
+ *  Output.....:  -
+ *  Globals....:  G_slot
+ ****************************************************************************/
+void A201M_ModPlug(
+	u_int32 slot,
+	u_int16 modId,
+	u_int16 layoutRev,
+	u_int16 variant )
+{
+	SLOT	*s = &G_slot[slot];
+
+	memset( s->idprom, 0xff, sizeof(s->idprom) );
+	s->idprom[0] = IDPROM_MAGIC;
+	s->idprom[1] = modId;
+	s->idprom[2] = layoutRev;
+	s->idprom[3] = variant;
+	s->present	 = TRUE;
+}
+
+/****************************** A201M_ModUnplug *****************************
+ *
+ *  Description:  Removes the M-Module of a slot
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  slot		slot 0..A201M_SLOTS-1
+ *  Output.....:  -
+ *  Globals....:  G_slot
+ ****************************************************************************/
+void A201M_ModUnplug( u_int32 slot )
+{
+	G_slot[slot].present = FALSE;
+	G_slot[slot].pending = FALSE;
+}
+
+/******************************** A201M_IrqSet ******************************
+ *
+ *  Description:  Sets/clears the interrupt request of the module in a slot
+ *                (pending bit of the control register)
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  slot		slot 0..A201M_SLOTS-1
+ *                pending	irq requested
+ *  Output.....:  -
+ *  Globals....:  G_slot
+ ****************************************************************************/
+void A201M_IrqSet( u_int32 slot, u_int32 pending )
+{
+	G_slot[slot].pending = pending;
+}
+
+/******************************** A201M_CtrlGet *****************************
+ *
+ *  Description:  Returns the control register of a slot (not counted)
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  slot		slot 0..A201M_SLOTS-1
+ *  Output.....:  return	control register
+ *  Globals....:  G_slot
+ ****************************************************************************/
+u_int16 A201M_CtrlGet( u_int32 slot )
+{
+	return G_slot[slot].ctrl;
+}
+
+/******************************** A201M_VectGet *****************************
+ *
+ *  Description:  Returns the vector register of a slot (not counted)
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  slot		slot 0..A201M_SLOTS-1
+ *  Output.....:  return	vector register
+ *  Globals....:  G_slot
+ ****************************************************************************/
+u_int16 A201M_VectGet( u_int32 slot )
+{
+	return G_slot[slot].vect;
+}
+
+/******************************* A201M_StatsGet *****************************
+ *
+ *  Description:  Returns the access counters and the simulated bus time
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  -
+ *  Output.....:  stats		counters
+ *  Globals....:  G_stats
+ ****************************************************************************/
+void A201M_StatsGet( A201M_STATS *stats )
+{
+	*stats = G_stats;
+}
+
+/****************************** A201M_StatsReset ****************************
+ *
+ *  Description:  Clears the access counters and the simulated bus time
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  -
+ *  Output.....:  -
+ *  Globals....:  G_stats
+ ****************************************************************************/
+void A201M_StatsReset( void )
+{
+	memset( &G_stats, 0, sizeof(G_stats) );
+}
+
+/********************************* A201M_Map ********************************
+ *
+ *  Description:  Maps a part of the board address space (for
+ *                OSS_MapPhysToVirtAddr)
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  physAddr	local address
+ *                size		size in bytes
+ *  Output.....:  return	virtual address or NULL if outside the board
+ *  Globals....:  G_mem, G_stats
+ ****************************************************************************/
+void* A201M_Map( void *physAddr, u_int32 size )
+{
+	U_INT32_OR_64	offs = (U_INT32_OR_64)physAddr - A201M_PHYS_ADDR;
+
+	if( (U_INT32_OR_64)physAddr < A201M_PHYS_ADDR ||
+		offs + size > A201M_SIZE )
+		return NULL;
+
+	G_stats.maps++;
+	BusTime( G_cost.mapNs );
+	return (u_int8*)G_mem + offs;
+}
+
+/******************************** A201M_Unmap *******************************
+ *
+ *  Description:  Releases a mapping of A201M_Map (for OSS_UnMapVirtAddr)
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  virtAddr	virtual address
+ *                size		size in bytes
+ *  Output.....:  return	0 | ERR_OSS_ILL_PARAM
+ *  Globals....:  G_stats
+ ****************************************************************************/
+int32 A201M_Unmap( void *virtAddr, u_int32 size )
+{
+	if( (u_int8*)virtAddr < (u_int8*)G_mem ||
+		(u_int8*)virtAddr + size > (u_int8*)G_mem + A201M_SIZE )
+		return 1;
+
+	G_stats.unmaps++;
+	BusTime( G_cost.mapNs );
+	return 0;
+}
+
+/******************************** A201M_Count *******************************
+ *
+ *  Description:  Counts an OSS resource event of the host OSS
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  what		A201M_CNT_xxx
+ *  Output.....:  -
+ *  Globals....:  G_stats
+ ****************************************************************************/
+void A201M_Count( u_int32 what )
+{
+	switch( what ){
+		case A201M_CNT_MEMGET:	G_stats.memGets++;	break;
+		case A201M_CNT_MEMFREE:	G_stats.memFrees++;	break;
+		case A201M_CNT_ALARM:	G_stats.alarms++;	break;
+		case A201M_CNT_SEM:		G_stats.sems++;		break;
+	}
+}
+
+/***************************** A201_CtrlHookWrite ***************************
+ *
+ *  Description:  D16 write to the control or vector register of a slot
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  ctrlAddr	mapped control register of the slot
+ *                offs		0x00=control, 0x02=vector
+ *                val		value
+ *  Output.....:  -
+ *  Globals....:  G_slot, G_stats
+ ****************************************************************************/
+void A201_CtrlHookWrite( void *ctrlAddr, u_int32 offs, u_int16 val )
+{
+	SLOT	*s = SlotOf( ctrlAddr, CTRL_OFFS );
+
+	if( offs == 0 )
+		s->ctrl = val & (A201M_CTRL_LEVEL | A201M_CTRL_ENABLE);
+	else
+		s->vect = val & 0xff;
+
+	G_stats.d16Wr++;
+	BusTime( G_cost.d16Ns );
+}
+
+/***************************** A201_CtrlHookRead ****************************
+ *
+ *  Description:  D16 read of the control or vector register of a slot
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  ctrlAddr	mapped control register of the slot
+ *                offs		0x00=control, 0x02=vector
+ *  Output.....:  return	register value
+ *  Globals....:  G_slot, G_stats
+ ****************************************************************************/
+u_int16 A201_CtrlHookRead( void *ctrlAddr, u_int32 offs )
+{
+	SLOT	*s = SlotOf( ctrlAddr, CTRL_OFFS );
+
+	G_stats.d16Rd++;
+	BusTime( G_cost.d16Ns );
+
+	if( offs )
+		return s->vect;
+
+	return (u_int16)(s->ctrl | (s->pending ? A201M_CTRL_PENDING : 0));
+}
+
+/**************************** A201_CtrlHookWrite32 **************************
+ *
+ *  Description:  D32 write to control (upper word) and vector register
+ *                (lower word) of a slot
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  ctrlAddr	mapped control register of the slot
+ *                offs		0x00
+ *                val		value
+ *  Output.....:  -
+ *  Globals....:  G_slot, G_stats
+ ****************************************************************************/
+void A201_CtrlHookWrite32( void *ctrlAddr, u_int32 offs, u_int32 val )
+{
+	SLOT	*s = SlotOf( ctrlAddr, CTRL_OFFS );
+
+	(void)offs;
+	s->ctrl = (u_int16)(val >> 16) & (A201M_CTRL_LEVEL | A201M_CTRL_ENABLE);
+	s->vect = (u_int16)val & 0xff;
+
+	G_stats.d32Wr++;
+	BusTime( G_cost.d32Ns );
+}
+
+/********************************** m_read **********************************
+ *
+ *  Description:  Reads one ID-PROM word of the module in a slot
+ *
+ *                Charged as idpromAcc D16 accesses (serial EEPROM).
+ *                An empty slot reads 0xffff.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  addr		mapped A08 module window of the slot
+ *                index		word index
+ *  Output.....:  return	ID-PROM word
+ *  Globals....:  G_slot, G_stats
+ ****************************************************************************/
+u_int16 m_read( U_INT32_OR_64 addr, u_int8 index )
+{
+	SLOT	*s = SlotOf( (void*)addr, 0 );
+
+	G_stats.idpromWords++;
+	BusTime( (u_int64)G_cost.idpromAcc * G_cost.d16Ns );
+
+	if( !s->present || index >= A201M_IDPROM_WORDS )
+		return 0xffff;
+
+	return s->idprom[index];
+}
+
+/******************************* m_getmodinfo *******************************
+ *
+ *  Description:  Reads the identification of the module in a slot
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  addr		mapped A08 module window of the slot
+ *  Output.....:  modtype	MODCOM_MOD_MEN | MODCOM_MOD_THIRD
+ *                devid		magic << 16 | module id
+ *                devrev	layout revision << 16 | product variant
+ *                devname	"M<module id>"
+ *                return	0
+ *  Globals....:  -
+ ****************************************************************************/
+int m_getmodinfo(
+	U_INT32_OR_64 addr,
+	u_int32 *modtype,
+	u_int32 *devid,
+	u_int32 *devrev,
+	char *devname )
+{
+	u_int16	w[A201M_IDPROM_WORDS];
+	u_int8	i;
+
+	for( i=0; i<A201M_IDPROM_WORDS; i++ )
+		w[i] = m_read( addr, i );
+
+	*devid	= ((u_int32)w[0] << 16) | w[1];
+	*devrev = ((u_int32)w[2] << 16) | w[3];
+
+	if( w[0] != IDPROM_MAGIC ){
+		*modtype = MODCOM_MOD_THIRD;
+		return 0;
+	}
+
+	*modtype = MODCOM_MOD_MEN;
+	sprintf( devname, "M%d", w[1] );
+	return 0;
+}
+
+/* swapped variants (id_sw library), the model is byte order neutral */
+u_int16 m_read_sw( U_INT32_OR_64 addr, u_int8 index )
+{
+	return m_read( addr, index );
+}
+
+int m_getmodinfo_sw(
+	U_INT32_OR_64 addr,
+	u_int32 *modtype,
+	u_int32 *devid,
+	u_int32 *devrev,
+	char *devname )
+{
+	return m_getmodinfo( addr, modtype, devid, devrev, devname );
+}
+
+/********************************** SlotOf **********************************
+ *
+ *  Description:  Returns the slot of a mapped address
+ *
+ *                Aborts on an address that is not 'offs' in a slot block,
+ *                i.e. on a handler access outside the modelled registers.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  addr		mapped address
+ *                offs		expected offset in the slot block
+ *  Output.....:  return	slot
+ *  Globals....:  G_mem, G_slot
+ ****************************************************************************/
+static SLOT *SlotOf( void *addr, u_int32 offs )
+{
+	U_INT32_OR_64	o = (U_INT32_OR_64)addr - (U_INT32_OR_64)G_mem;
+
+	if( (u_int8*)addr < (u_int8*)G_mem || o >= A201M_SIZE ||
+		o % SLOT_STRIDE != offs ){
+		fprintf( stderr, "*** a201_model: access to %p (offset 0x%lx) outside "
+				 "the modelled registers\n", addr, (unsigned long)o );
+		abort();
+	}
+
+	return &G_slot[o / SLOT_STRIDE];
+}
+
+/******************************* A201_HrStamp *******************************
+ *
+ *  Description:  High resolution time stamp of the handler (A201_HRTIME):
+ *                the simulated bus time (ns)
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  -
+ *  Output.....:  return	time stamp
+ *  Globals....:  G_busTime
+ ****************************************************************************/
+u_int32 A201_HrStamp( void )
+{
+	return (u_int32)G_busTime;
+}
+
+u_int32 A201_HrStampHz( void )
+{
+	return 1000000000;
+}
+
+/********************************** BusTime *********************************
+ *
+ *  Description:  Charges simulated bus time
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  ns		time
+ *  Output.....:  -
+ *  Globals....:  G_stats, G_busTime
+ ****************************************************************************/
+static void BusTime( u_int64 ns )
+{
+	G_stats.busNs += ns;
+	G_busTime	  += ns;
+}
+
+/********************************** EnvGet **********************************
+ *
+ *  Description:  Returns a numeric environment variable
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  name		variable
+ *                defVal	value if not set
+ *  Output.....:  return	value
+ *  Globals....:  -
+ ****************************************************************************/
+static u_int32 EnvGet( const char *name, u_int32 defVal )
+{
+	const char	*val = getenv( name );
+
+	return val ? (u_int32)strtoul( val, NULL, 0 ) : defVal;
+}
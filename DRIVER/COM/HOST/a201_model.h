@@ -0,0 +1,104 @@
+/***********************  I n c l u d e  -  F i l e  ************************
+ *
+ *         Name: a201_model.h
+ *
+ *  Description: software model of the A201/B201/B202 carrier and of the
+ *               host OSS stub (host build of the board handler)
+ *
+ *     Switches: -
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2026, MEN Mikro Elektronik GmbH
+ ******************************************************************************/
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _A201_MODEL_H
+#define _A201_MODEL_H
+
+#include <MEN/men_typs.h>
+#include <MEN/oss.h>
+
+/*-----------------------------------------+
+|  DEFINES                                 |
++-----------------------------------------*/
+#define A201M_PHYS_ADDR		0xe0000000	/* local address of the board */
+#define A201M_SIZE			0x800		/* board address space */
+#define A201M_SLOTS			4			/* model slots (A201) */
+#define A201M_IDPROM_WORDS	16			/* ID-PROM size (words) */
+
+/* control register bits */
+#define A201M_CTRL_LEVEL	0x07
+#define A201M_CTRL_ENABLE	0x10
+#define A201M_CTRL_PENDING	0x20
+
+/*-----------------------------------------+
+|  TYPEDEFS                                |
++-----------------------------------------*/
+/* bus cost model (simulated ns per access) */
+typedef struct
+{
+	u_int32	d16Ns;			/* D16 control/vector access */
+	u_int32	d32Ns;			/* D32 control+vector access */
+	u_int32	idpromAcc;		/* D16 accesses per ID-PROM word (bit-bang) */
+	u_int32	mapNs;			/* OSS_MapPhysToVirtAddr/OSS_UnMapVirtAddr */
+} A201M_COST;
+
+/* access counters */
+typedef struct
+{
+	u_int32	d16Rd;			/* D16 control/vector reads */
+	u_int32	d16Wr;			/* D16 control/vector writes */
+	u_int32	d32Wr;			/* D32 control+vector writes */
+	u_int32	idpromWords;	/* ID-PROM words read */
+	u_int32	maps;			/* mappings created */
+	u_int32	unmaps;			/* mappings released */
+	u_int32	memGets;		/* OSS_MemGet calls */
+	u_int32	memFrees;		/* OSS_MemFree calls */
+	u_int32	alarms;			/* OSS_AlarmCreate calls */
+	u_int32	sems;			/* OSS_SemCreate calls */
+	u_int64	busNs;			/* simulated bus time */
+} A201M_STATS;
+
+/*-----------------------------------------+
+|  PROTOTYPES                              |
++-----------------------------------------*/
+/* carrier model (a201_model.c) */
+extern void A201M_Init( const A201M_COST *cost );
+extern void A201M_ModPlug( u_int32 slot, u_int16 modId, u_int16 layoutRev,
+						   u_int16 variant );
+extern void A201M_ModUnplug( u_int32 slot );
+extern void A201M_IrqSet( u_int32 slot, u_int32 pending );
+extern u_int16 A201M_CtrlGet( u_int32 slot );
+extern u_int16 A201M_VectGet( u_int32 slot );
+extern void A201M_StatsGet( A201M_STATS *stats );
+extern void A201M_StatsReset( void );
+extern void* A201M_Map( void *physAddr, u_int32 size );
+extern int32 A201M_Unmap( void *virtAddr, u_int32 size );
+extern void A201M_Count( u_int32 what );
+
+/* A201M_Count() events */
+#define A201M_CNT_MEMGET	1
+#define A201M_CNT_MEMFREE	2
+#define A201M_CNT_ALARM		3
+#define A201M_CNT_SEM		4
+
+/* host OSS (oss_host.c) */
+extern OSS_HANDLE* HostOssInit( void );
+extern void HostOssAdvance( u_int32 msec );
+extern u_int32 HostOssMemInUse( void );
+extern void HostOssSigHook( void (*fkt)( int32 value ) );
+
+#endif /* _A201_MODEL_H */
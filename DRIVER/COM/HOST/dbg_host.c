@@ -0,0 +1,65 @@
+/*********************  P r o g r a m  -  M o d u l e ***********************
+ *
+ *         Name: dbg_host.c
+ *      Project: A201/B201/B202 board handler (host build)
+ *
+ *  Description: Minimal DBG library for the host build (output to stderr)
+ *
+ *     Required: -
+ *     Switches: -
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2026, MEN Mikro Elektronik GmbH
+ ******************************************************************************/
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+
+#include <MEN/men_typs.h>
+#include <MEN/dbg.h>
+
+/* there is only one debug output */
+struct DBG_HANDLE
+{
+	int		dummy;
+};
+
+static DBG_HANDLE G_dbg;
+
+int32 DBG_Init( char *name, DBG_HANDLE **dbgP )
+{
+	(void)name;
+	*dbgP = &G_dbg;
+	return 0;
+}
+
+int32 DBG_Exit( DBG_HANDLE **dbgP )
+{
+	*dbgP = NULL;
+	return 0;
+}
+
+int32 DBG_Write( DBG_HANDLE *dbg, char *frmt, ... )
+{
+	va_list	ap;
+
+	(void)dbg;
+
+	va_start( ap, frmt );
+	vfprintf( stderr, frmt, ap );
+	va_end( ap );
+	return 0;
+}
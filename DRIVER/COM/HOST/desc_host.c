@@ -0,0 +1,168 @@
+/*********************  P r o g r a m  -  M o d u l e ***********************
+ *
+ *         Name: desc_host.c
+ *      Project: A201/B201/B202 board handler (host build)
+ *
+ *  Description: Minimal DESC library for the host build
+ *
+ *               The descriptor specifier is a HOST_DESC_KEY table
+ *               terminated by an entry with name=NULL (see MEN/desc.h).
+ *
+ *     Required: -
+ *     Switches: -
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2026, MEN Mikro Elektronik GmbH
+ ******************************************************************************/
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <MEN/men_typs.h>
+#include <MEN/oss.h>
+#include <MEN/desc.h>
+#include <MEN/mdis_err.h>
+
+/*-----------------------------------------+
+|  TYPEDEFS                                |
++------------------------------------------*/
+struct DESC_HANDLE
+{
+	const HOST_DESC_KEY	*keys;		/* descriptor table */
+	u_int32				dbgLevel;	/* unused */
+};
+
+/*-----------------------------------------+
+|  PROTOTYPES                              |
++------------------------------------------*/
+static const HOST_DESC_KEY *KeyFind( DESC_HANDLE *descHdl, u_int32 type,
+									 const char *keyFmt, va_list ap );
+
+char* DESC_Ident( void )
+{
+	return "DESC host stub";
+}
+
+int32 DESC_Init( DESC_SPEC *descSpec, OSS_HANDLE *osHdl,
+				 DESC_HANDLE **descHdlP )
+{
+	DESC_HANDLE	*descHdl = calloc( 1, sizeof(*descHdl) );
+
+	(void)osHdl;
+
+	if( !(*descHdlP = descHdl) )
+		return ERR_OSS_MEM_ALLOC;
+
+	descHdl->keys = (const HOST_DESC_KEY*)descSpec;
+	return 0;
+}
+
+int32 DESC_Exit( DESC_HANDLE **descHdlP )
+{
+	free( *descHdlP );
+	*descHdlP = NULL;
+	return 0;
+}
+
+void DESC_DbgLevelSet( DESC_HANDLE *descHdl, u_int32 dbgLevel )
+{
+	descHdl->dbgLevel = dbgLevel;
+}
+
+int32 DESC_GetUInt32(
+	DESC_HANDLE *descHdl,
+	u_int32 defVal,
+	u_int32 *valueP,
+	char *keyFmt, ... )
+{
+	const HOST_DESC_KEY	*key;
+	va_list				ap;
+
+	va_start( ap, keyFmt );
+	key = KeyFind( descHdl, DESC_TYPE_U_INT32, keyFmt, ap );
+	va_end( ap );
+
+	if( !key ){
+		*valueP = defVal;
+		return ERR_DESC_KEY_NOTFOUND;
+	}
+
+	*valueP = key->val;
+	return 0;
+}
+
+int32 DESC_GetBinary(
+	DESC_HANDLE *descHdl,
+	u_int8 *defVal,
+	u_int32 defLen,
+	u_int8 *bufP,
+	u_int32 *lenP,
+	char *keyFmt, ... )
+{
+	const HOST_DESC_KEY	*key;
+	va_list				ap;
+
+	va_start( ap, keyFmt );
+	key = KeyFind( descHdl, DESC_TYPE_BINARY, keyFmt, ap );
+	va_end( ap );
+
+	if( !key ){
+		if( defLen > *lenP )
+			return ERR_DESC_BUF_TOOSMALL;
+		memmove( bufP, defVal, defLen );
+		*lenP = defLen;
+		return ERR_DESC_KEY_NOTFOUND;
+	}
+
+	if( key->len > *lenP )
+		return ERR_DESC_BUF_TOOSMALL;
+
+	memcpy( bufP, key->arr, key->len );
+	*lenP = key->len;
+	return 0;
+}
+
+/********************************** KeyFind *********************************
+ *
+ *  Description:  Looks up a key of the given type
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  descHdl	descriptor handle
+ *                type		DESC_TYPE_xxx
+ *                keyFmt	key name (printf format)
+ *                ap		format arguments
+ *  Output.....:  return	key or NULL
+ *  Globals....:  -
+ ****************************************************************************/
+static const HOST_DESC_KEY *KeyFind(
+	DESC_HANDLE *descHdl,
+	u_int32 type,
+	const char *keyFmt,
+	va_list ap )
+{
+	const HOST_DESC_KEY	*key;
+	char				name[128];
+
+	vsnprintf( name, sizeof(name), keyFmt, ap );
+
+	for( key=descHdl->keys; key && key->name; key++ )
+		if( key->type == type && !strcmp( key->name, name ) )
+			return key;
+
+	return NULL;
+}
@@ -0,0 +1,514 @@
+/*********************  P r o g r a m  -  M o d u l e ***********************
+ *
+ *         Name: oss_host.c
+ *      Project: A201/B201/B202 board handler (host build)
+ *
+ *  Description: Minimal OSS for the host build
+ *
+ *               Single threaded: time is simulated in 1ms ticks and only
+ *               advances in HostOssAdvance, OSS_Delay and blocking
+ *               OSS_SemWait calls, which also run the due alarms.
+ *               Tasks started by A201_TaskStart (A201_TASK_HOOK) run
+ *               to completion at the begin of the next tick.
+ *               Mappings are served by the carrier model (a201_model.c),
+ *               every VME address translates to A201M_PHYS_ADDR.
+ *               Signals are delivered at once to the hook installed by
+ *               HostOssSigHook (test process).
+ *               Spin locks abort on recursive acquire or unbalanced
+ *               release, so lock discipline errors show up on the host.
+ *
+ *     Required: -
+ *     Switches: -
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2026, MEN Mikro Elektronik GmbH
+ ******************************************************************************/
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <MEN/men_typs.h>
+#include <MEN/oss.h>
+#include <MEN/mdis_err.h>
+#include "a201_model.h"
+
+/*-----------------------------------------+
+|  DEFINES                                 |
++------------------------------------------*/
+#define SEM_WAIT_MAX	600000		/* OSS_SEM_WAITFOREVER limit (ticks) */
+#define TASK_MAX		8			/* pending tasks */
+
+/*-----------------------------------------+
+|  TYPEDEFS                                |
++------------------------------------------*/
+struct OSS_HANDLE
+{
+	u_int32	memInUse;				/* bytes allocated */
+};
+
+struct OSS_ALARM_HANDLE
+{
+	void	(*funct)( void *arg );	/* alarm routine */
+	void	*arg;					/* its argument */
+	u_int32	active;					/* armed */
+	u_int32	cyclic;					/* re-arm after firing */
+	u_int32	period;					/* ticks */
+	u_int32	due;					/* tick to fire */
+	struct OSS_ALARM_HANDLE *next;
+};
+
+struct OSS_SEM_HANDLE
+{
+	int32	semType;				/* OSS_SEM_xxx */
+	int32	value;					/* count */
+};
+
+struct OSS_SIG_HANDLE
+{
+	int32	value;					/* signal number */
+};
+
+struct OSS_SPINL_HANDLE
+{
+	u_int32	locked;					/* held */
+};
+
+/*-----------------------------------------+
+|  GLOBALS                                 |
++------------------------------------------*/
+static OSS_HANDLE		G_oss;
+static OSS_ALARM_HANDLE	*G_alarms;		/* all created alarms */
+static u_int32			G_tick;			/* simulated time */
+static struct {
+	void	(*fkt)( void *arg );
+	void	*arg;
+} G_task[TASK_MAX];						/* pending tasks */
+static u_int32			G_taskCnt;
+static void				(*G_sigHook)( int32 value );	/* signal receiver */
+
+/******************************** HostOssInit *******************************
+ *
+ *  Description:  Returns the OSS handle of the host OSS
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  -
+ *  Output.....:  return	OSS handle
+ *  Globals....:  G_oss
+ ****************************************************************************/
+OSS_HANDLE* HostOssInit( void )
+{
+	return &G_oss;
+}
+
+/****************************** HostOssAdvance ******************************
+ *
+ *  Description:  Advances the simulated time and runs the due alarms
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  msec		time (ms)
+ *  Output.....:  -
+ *  Globals....:  G_tick, G_alarms
+ ****************************************************************************/
+void HostOssAdvance( u_int32 msec )
+{
+	OSS_ALARM_HANDLE	*alm, *next;
+	void				(*fkt)( void *arg );
+	void				*arg;
+
+	while( msec-- ){
+		G_tick++;
+
+		while( G_taskCnt ){
+			fkt = G_task[0].fkt;
+			arg = G_task[0].arg;
+			memmove( &G_task[0], &G_task[1],
+					 --G_taskCnt * sizeof(G_task[0]) );
+			fkt( arg );
+		}
+
+		for( alm=G_alarms; alm; alm=next ){
+			next = alm->next;
+			if( !alm->active || (int32)(G_tick - alm->due) < 0 )
+				continue;
+
+			if( alm->cyclic )
+				alm->due += alm->period;
+			else
+				alm->active = FALSE;
+
+			alm->funct( alm->arg );
+		}
+	}
+}
+
+/******************************* A201_TaskStart *****************************
+ *
+ *  Description:  Starts a task of the handler (A201_TASK_HOOK)
+ *
+ *                The task runs to completion at the begin of the
+ *                next tick.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  fkt		task routine
+ *                arg		its argument
+ *  Output.....:  return	success (0) or error code
+ *  Globals....:  G_task, G_taskCnt
+ ****************************************************************************/
+int32 A201_TaskStart( void (*fkt)( void *arg ), void *arg )
+{
+	if( G_taskCnt == TASK_MAX )
+		return ERR_OSS_MEM_ALLOC;
+
+	G_task[G_taskCnt].fkt = fkt;
+	G_task[G_taskCnt].arg = arg;
+	G_taskCnt++;
+	return ERR_SUCCESS;
+}
+
+/****************************** HostOssSigHook ******************************
+ *
+ *  Description:  Installs the receiver of the signals sent by OSS_SigSend
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  fkt		receiver or NULL (signals are dropped)
+ *  Output.....:  -
+ *  Globals....:  G_sigHook
+ ****************************************************************************/
+void HostOssSigHook( void (*fkt)( int32 value ) )
+{
+	G_sigHook = fkt;
+}
+
+/****************************** HostOssMemInUse *****************************
+ *
+ *  Description:  Returns the bytes allocated by OSS_MemGet
+ *
+ *---------------------------------------------------------------------------
+ *  Input......:  -
+ *  Output.....:  return	bytes
+ *  Globals....:  G_oss
+ ****************************************************************************/
+u_int32 HostOssMemInUse( void )
+{
+	return G_oss.memInUse;
+}
+
+char* OSS_Ident( void )
+{
+	return "OSS host stub";
+}
+
+void* OSS_MemGet( OSS_HANDLE *oss, u_int32 size, u_int32 *gotsizeP )
+{
+	void	*mem = malloc( size );
+
+	*gotsizeP = mem ? size : 0;
+	if( mem ){
+		oss->memInUse += size;
+		A201M_Count( A201M_CNT_MEMGET );
+	}
+	return mem;
+}
+
+int32 OSS_MemFree( OSS_HANDLE *oss, void *addr, u_int32 size )
+{
+	oss->memInUse -= size;
+	A201M_Count( A201M_CNT_MEMFREE );
+	free( addr );
+	return 0;
+}
+
+void OSS_MemFill( OSS_HANDLE *oss, u_int32 size, char *adr, int8 value )
+{
+	(void)oss;
+	memset( adr, value, size );
+}
+
+void OSS_MemCopy( OSS_HANDLE *oss, u_int32 size, char *src, char *dest )
+{
+	(void)oss;
+	memmove( dest, src, size );
+}
+
+int32 OSS_Sprintf( OSS_HANDLE *oss, char *str, const char *fmt, ... )
+{
+	va_list	ap;
+	int32	n;
+
+	(void)oss;
+
+	va_start( ap, fmt );
+	n = vsprintf( str, fmt, ap );
+	va_end( ap );
+	return n;
+}
+
+int32 OSS_BusToPhysAddr( OSS_HANDLE *oss, int32 busType,
+						 void **physicalAddrP, ... )
+{
+	(void)oss;
+	(void)busType;
+	/* the model is the only board on the bus */
+	*physicalAddrP = (void*)(U_INT32_OR_64)A201M_PHYS_ADDR;
+	return 0;
+}
+
+int32 OSS_MapPhysToVirtAddr(
+	OSS_HANDLE *oss,
+	void *physAddr,
+	u_int32 size,
+	int32 addrSpace,
+	int32 busType,
+	int32 busNbr,
+	void **virtAddrP )
+{
+	(void)oss;
+	(void)addrSpace;
+	(void)busType;
+	(void)busNbr;
+	*virtAddrP = A201M_Map( physAddr, size );
+	return *virtAddrP ? 0 : ERR_OSS_MAP_FAILED;
+}
+
+int32 OSS_UnMapVirtAddr(
+	OSS_HANDLE *oss,
+	void **virtAddrP,
+	u_int32 size,
+	int32 addrSpace )
+{
+	(void)oss;
+	(void)addrSpace;
+	if( A201M_Unmap( *virtAddrP, size ) )
+		return ERR_OSS_ILL_PARAM;
+
+	*virtAddrP = NULL;
+	return 0;
+}
+
+int32 OSS_AssignResources( OSS_HANDLE *oss, int32 busType, int32 busNbr,
+						   int32 resNbr, OSS_RESOURCES res[] )
+{
+	(void)oss;
+	(void)busType;
+	(void)busNbr;
+	(void)resNbr;
+	(void)res;
+	return 0;
+}
+
+int32 OSS_AlarmCreate(
+	OSS_HANDLE *oss,
+	void (*funct)( void *arg ),
+	void *arg,
+	OSS_ALARM_HANDLE **alarmP )
+{
+	OSS_ALARM_HANDLE	*alm = calloc( 1, sizeof(*alm) );
+
+	(void)oss;
+
+	if( !(*alarmP = alm) )
+		return ERR_OSS_MEM_ALLOC;
+
+	alm->funct = funct;
+	alm->arg   = arg;
+	alm->next  = G_alarms;
+	G_alarms   = alm;
+	A201M_Count( A201M_CNT_ALARM );
+	return 0;
+}
+
+int32 OSS_AlarmRemove( OSS_HANDLE *oss, OSS_ALARM_HANDLE **alarmP )
+{
+	OSS_ALARM_HANDLE	**pp;
+
+	(void)oss;
+
+	for( pp=&G_alarms; *pp; pp=&(*pp)->next )
+		if( *pp == *alarmP ){
+			*pp = (*alarmP)->next;
+			break;
+		}
+
+	free( *alarmP );
+	*alarmP = NULL;
+	return 0;
+}
+
+int32 OSS_AlarmSet(
+	OSS_HANDLE *oss,
+	OSS_ALARM_HANDLE *alarm,
+	u_int32 msec,
+	u_int32 cyclic,
+	u_int32 *realMsecP )
+{
+	(void)oss;
+	alarm->period = msec ? msec : 1;
+	alarm->due	  = G_tick + alarm->period;
+	alarm->cyclic = cyclic;
+	alarm->active = TRUE;
+	*realMsecP	  = alarm->period;
+	return 0;
+}
+
+int32 OSS_AlarmClear( OSS_HANDLE *oss, OSS_ALARM_HANDLE *alarm )
+{
+	(void)oss;
+	alarm->active = FALSE;
+	return 0;
+}
+
+int32 OSS_SemCreate(
+	OSS_HANDLE *oss,
+	int32 semType,
+	int32 initVal,
+	OSS_SEM_HANDLE **semP )
+{
+	OSS_SEM_HANDLE	*sem = calloc( 1, sizeof(*sem) );
+
+	(void)oss;
+
+	if( !(*semP = sem) )
+		return ERR_OSS_MEM_ALLOC;
+
+	sem->semType = semType;
+	sem->value	 = initVal;
+	A201M_Count( A201M_CNT_SEM );
+	return 0;
+}
+
+int32 OSS_SemRemove( OSS_HANDLE *oss, OSS_SEM_HANDLE **semP )
+{
+	(void)oss;
+	free( *semP );
+	*semP = NULL;
+	return 0;
+}
+
+int32 OSS_SemWait( OSS_HANDLE *oss, OSS_SEM_HANDLE *sem, int32 msec )
+{
+	u_int32	left = msec == OSS_SEM_WAITFOREVER ? SEM_WAIT_MAX : (u_int32)msec;
+
+	(void)oss;
+
+	/* nobody else runs: let the alarms signal meanwhile */
+	while( sem->value == 0 ){
+		if( left-- == 0 )
+			return ERR_OSS_TIMEOUT;
+		HostOssAdvance( 1 );
+	}
+
+	sem->value--;
+	return 0;
+}
+
+int32 OSS_SemSignal( OSS_HANDLE *oss, OSS_SEM_HANDLE *sem )
+{
+	(void)oss;
+	if( sem->semType == OSS_SEM_BIN )
+		sem->value = 1;
+	else
+		sem->value++;
+	return 0;
+}
+
+int32 OSS_SigCreate( OSS_HANDLE *oss, int32 value, OSS_SIG_HANDLE **sigP )
+{
+	(void)oss;
+	if( !(*sigP = calloc( 1, sizeof(**sigP) )) )
+		return ERR_OSS_MEM_ALLOC;
+	(*sigP)->value = value;
+	return 0;
+}
+
+int32 OSS_SigRemove( OSS_HANDLE *oss, OSS_SIG_HANDLE **sigP )
+{
+	(void)oss;
+	free( *sigP );
+	*sigP = NULL;
+	return 0;
+}
+
+int32 OSS_SigSend( OSS_HANDLE *oss, OSS_SIG_HANDLE *sig )
+{
+	(void)oss;
+	if( G_sigHook )
+		G_sigHook( sig->value );
+	return 0;
+}
+
+int32 OSS_SpinLockCreate( OSS_HANDLE *oss, OSS_SPINL_HANDLE **spinlP )
+{
+	(void)oss;
+	if( !(*spinlP = calloc( 1, sizeof(**spinlP) )) )
+		return ERR_OSS_MEM_ALLOC;
+	return 0;
+}
+
+int32 OSS_SpinLockRemove( OSS_HANDLE *oss, OSS_SPINL_HANDLE **spinlP )
+{
+	(void)oss;
+	if( (*spinlP)->locked ){
+		fprintf( stderr, "*** OSS_SpinLockRemove: lock held\n" );
+		abort();
+	}
+	free( *spinlP );
+	*spinlP = NULL;
+	return 0;
+}
+
+int32 OSS_SpinLockAcquire( OSS_HANDLE *oss, OSS_SPINL_HANDLE *spinl )
+{
+	(void)oss;
+	/* single threaded: a held lock would never be released */
+	if( spinl->locked ){
+		fprintf( stderr, "*** OSS_SpinLockAcquire: recursive acquire\n" );
+		abort();
+	}
+	spinl->locked = TRUE;
+	return 0;
+}
+
+int32 OSS_SpinLockRelease( OSS_HANDLE *oss, OSS_SPINL_HANDLE *spinl )
+{
+	(void)oss;
+	if( !spinl->locked ){
+		fprintf( stderr, "*** OSS_SpinLockRelease: lock not held\n" );
+		abort();
+	}
+	spinl->locked = FALSE;
+	return 0;
+}
+
+u_int32 OSS_TickGet( OSS_HANDLE *oss )
+{
+	(void)oss;
+	return G_tick;
+}
+
+int32 OSS_TickRateGet( OSS_HANDLE *oss )
+{
+	(void)oss;
+	return 1000;
+}
+
+int32 OSS_Delay( OSS_HANDLE *oss, int32 msec )
+{
+	(void)oss;
+	HostOssAdvance( msec ? (u_int32)msec : 1 );
+	return msec;
+}
@@ -13,6 +13,18 @@
  *               A201_NTSW	: NT variant with swapped access
  *				 B201		: make B201 BBIS handler
  *				 B202		: make B202 BBIS handler
+ *				 A201_CTRL_HOOK	: route control/vector register accesses
+ *							  through A201_CtrlHookRead/Write
+ *				 A201_PERF_CNT	: count calls/register accesses per entry
+ *				 A201_IRQ_TRACE	: record interrupt events in trace rings
+ *				 A201_NO_ISR_DBG	: no debug output in the interrupt path
+ *				 A201_HRTIME	: interrupt service time statistics and
+ *							  latency histograms, based on
+ *							  A201_HrStamp/A201_HrStampHz
+ *				 A201_TASK_HOOK	: start tasks through A201_TaskStart
+ *							  instead of the OS (Linux kernel threads);
+ *							  without tasks there is no ID-PROM
+ *							  prefetch (see A201_BrdInit)
  *---------------------------[ Public Functions ]----------------------------
  *  
  *  A201_GetEntry          Gets the entry points of the BBIS handler functions. 
@@ -67,6 +79,23 @@
 #include <MEN/bb_defs.h>
 #include <MEN/bb_entry.h>
 #include <MEN/bb_a201.h>
+#include <MEN/bb_a201_codes.h>
+
+#if !defined(A201_TASK_HOOK) && defined(LINUX) && defined(__KERNEL__)
+# include <linux/kthread.h>
+# include <linux/slab.h>
+# include <linux/err.h>
+#endif
+
+/* TaskStart can start tasks (PnP scan tasks, ID-PROM prefetch) */
+#if defined(A201_TASK_HOOK) || (defined(LINUX) && defined(__KERNEL__))
+# define A201_TASKS
+#endif
+
+/* max. time A201_SetMIface waits for a running PnP scan pass (ms) */
+#ifndef A201_PNP_IFACE_TOUT
+# define A201_PNP_IFACE_TOUT	1000
+#endif
 
 #ifdef B201
     static const char IdentString[]=MENT_XSTR_SFX(MAK_REVISION,B201);
@@ -121,18 +150,187 @@
 #define A201_CTRL_DEFAULT      0x00            /* irq disable, level 0 */
 #define A201_VECT_DEFAULT      0x0f            /* uninitialized interrupt */
 
+#define A201_CTRL_IRQ_LEVEL    0x07            /* irq level mask */
 #define A201_CTRL_IRQ_ENABLE   0x10
+#define A201_CTRL_IRQ_PENDING  0x20            /* irq request pending (read) */
 
 /*------------------ address spaces --------------------------*/
 #define A201_SIZE               0x800
 #define A201_M_A08_SIZE         0x100            /* A08 size */
 
+/* status page: allocated on its own page(s), may be mapped to user space */
+#ifndef A201_PAGE_SIZE
+#	define A201_PAGE_SIZE		0x1000
+#endif
+#define A201_STATUS_SIZE \
+	((sizeof(A201_STATUS_PAGE) + A201_PAGE_SIZE - 1) & ~(A201_PAGE_SIZE - 1))
+
 /* debug handle */
 #define DBH		a201Hdl->debugHdl
 
+/*
+ * control/vector register access
+ * With A201_CTRL_HOOK set, the accesses are routed to externally supplied
+ * functions (e.g. a software model of the carrier on a host build).
+ */
+#ifdef A201_CTRL_HOOK
+# define CTRL_WRITE_D16(h,slot,offs,val) \
+	( PERF_ACC(h), A201_CtrlHookWrite( (h)->virtModCtrlAddr[slot], (offs), \
+									   (u_int16)(val) ) )
+# define CTRL_WRITE_D32(h,slot,offs,val) \
+	( PERF_ACC(h), A201_CtrlHookWrite32( (h)->virtModCtrlAddr[slot], (offs), \
+										 (u_int32)(val) ) )
+# define CTRL_READ_D16_AT(h,addr,offs) \
+	( PERF_ACC(h), A201_CtrlHookRead( (addr), (offs) ) )
+#else
+# define CTRL_WRITE_D16(h,slot,offs,val) \
+	( PERF_ACC(h), MWRITE_D16( (h)->virtModCtrlAddr[slot], (offs), (val) ) )
+# define CTRL_WRITE_D32(h,slot,offs,val) \
+	( PERF_ACC(h), MWRITE_D32( (h)->virtModCtrlAddr[slot], (offs), (val) ) )
+# define CTRL_READ_D16_AT(h,addr,offs) \
+	( PERF_ACC(h), MREAD_D16( (addr), (offs) ) )
+#endif
+#define CTRL_READ_D16(h,slot,offs) \
+	CTRL_READ_D16_AT( (h), (h)->virtModCtrlAddr[slot], (offs) )
+
+/*
+ * control+vector register as one long word at A201_CTRL_OFFS
+ * The VMEbus is big endian: the control register (offset 0x00) is the upper
+ * word, the vector register (offset 0x02) the lower word. With MAC_BYTESWAP,
+ * MWRITE_D32 swaps the whole long word, which keeps this lane order.
+ */
+#define A201_CTRL_VECT_D32(ctrl,vect) \
+	( ((u_int32)(ctrl) << 16) | (u_int16)(vect) )
+
+/* slot irq kept disabled by the handler (storm holdoff, polled mode) */
+#define IRQ_MASKED(h,slot)	((h)->stormHeld[slot] || (h)->pollMode[slot])
+
+/* big endian values of the A201_CONFIG record */
+#define CFG_GET16(p)	( ((u_int16)(p)[0] << 8) | (p)[1] )
+#define CFG_GET32(p)	( ((u_int32)CFG_GET16(p) << 16) | CFG_GET16((p)+2) )
+#define CFG_GETARR(h,p,arr) \
+	( OSS_MemCopy( (h)->osHdl, A201_NBR_OF_SLOTS, (char*)(p), \
+				   (char*)(h)->arr ), (p) += A201_NBR_OF_SLOTS )
+
+/* ID-PROM magic word of MEN M-Modules */
+#define A201_IDPROM_MAGIC	0x5346
+
+/*
+ * register lock
+ * Serializes the enable decision and the control/vector register write
+ * of task level, interrupt path and alarms (interrupt safe spin lock).
+ */
+#define REG_LOCK(h)		OSS_SpinLockAcquire( (h)->osHdl, (h)->regLock )
+#define REG_UNLOCK(h)	OSS_SpinLockRelease( (h)->osHdl, (h)->regLock )
+
+/* more than one slot in vectSlots[] mask */
+#define VECT_SHARED(mask)	((mask) & ((mask) - 1))
+
+/* slot of priority rank 'rank' in prioOrder (8 bit per rank) */
+#define PRIO_SLOT(order,rank)	( ((order) >> (8 * (rank))) & 0xff )
+
+/* system tick time stamp (storm/poll windows, trace) */
+#ifndef A201_TIMESTAMP
+# define A201_TIMESTAMP(h)	( (u_int32)OSS_TickGet( (h)->osHdl ) )
+#endif
+
+/*
+ * memory barrier between the interrupt path/alarms and task level
+ * (trace ring, poll signals)
+ * Other compilers: define A201_MEM_BARRIER or provide A201_MemBarrier().
+ */
+#ifndef A201_MEM_BARRIER
+# ifdef __GNUC__
+#  define A201_MEM_BARRIER()	__sync_synchronize()
+# else
+   extern void A201_MemBarrier( void );
+#  define A201_MEM_BARRIER()	A201_MemBarrier()
+# endif
+#endif
+
+/*
+ * high resolution time stamp (A201_HRTIME)
+ * The OSS tick is too coarse to measure interrupt service times, so the
+ * environment supplies a free running counter and its frequency.
+ */
+#ifdef A201_HRTIME
+# define HR_STAMP()		A201_HrStamp()
+#endif
+
+/* debug output in the interrupt path */
+#ifdef A201_NO_ISR_DBG
+# define ISR_DBGWRT_1(x)
+#else
+# define ISR_DBGWRT_1(x)	DBGWRT_1(x)
+#endif
+
+/*
+ * interrupt trace
+ * One ring per slot, written only by the slot's interrupt path (single
+ * producer) and drained by A201_BLK_IRQ_TRACE (single consumer).
+ */
+#ifdef A201_IRQ_TRACE
+# define IRQ_TRACE(h,slot,ev,val)	IrqTrace( (h), (slot), (ev), (val) )
+#else
+# define IRQ_TRACE(h,slot,ev,val)	( (void)(h) )
+#endif
+
+/*
+ * entry point counters
+ * Register accesses and allocations are booked to the running entry point
+ * (perfFkt). The interrupt path and the alarms restore perfFkt on return,
+ * so an interrupted task level call keeps its counts.
+ * (not locked, counts may be slightly off if task and interrupt level run
+ * on different CPUs at the same time)
+ */
+#ifdef A201_PERF_CNT
+# define PERF_CALL(h,fkt)		( (h)->perf.calls[fkt]++, (h)->perfFkt = (fkt) )
+# define PERF_ENTER(h,fkt,save)	( (save) = (h)->perfFkt, PERF_CALL(h,fkt) )
+# define PERF_LEAVE(h,save)		( (h)->perfFkt = (save) )
+# define PERF_ACC(h)			( (h)->perf.regAcc[(h)->perfFkt]++ )
+# define PERF_ALLOC(h)			( (h)->perf.allocs[(h)->perfFkt]++ )
+#else
+# define PERF_CALL(h,fkt)		( (void)(h) )
+# define PERF_ENTER(h,fkt,save)	( (save) = 0, (void)(h) )
+# define PERF_LEAVE(h,save)		( (void)(save) )
+# define PERF_ACC(h)			( (void)0 )
+# define PERF_ALLOC(h)			( (void)0 )
+#endif
+
 /*-----------------------------------------+
 |  TYPEDEFS                                |
 +------------------------------------------*/
+/* per slot alarm context */
+typedef struct
+{
+	OSS_ALARM_HANDLE	*alarmHdl;		/* alarm handle */
+	void				*brdHdl;		/* board handle */
+	u_int32				mSlot;			/* module slot */
+} A201_SLOT_ALARM;
+
+/* slot probe task of a PnP scan pass (PnpScanStart) */
+typedef struct
+{
+	void				*a201Hdl;		/* board handle */
+	u_int32				mSlot;			/* module slot */
+	int32				status;			/* probe result */
+} A201_SCAN_JOB;
+
+/* descriptor values processed by A201_Init */
+typedef struct
+{
+	u_int32	physAddr;				/* PHYS_ADDR */
+	u_int32	a24Addr;				/* VME_A24_ADDR */
+	u_int32	a16Addr;				/* VME_A16_ADDR */
+	u_int32	dataWidth;				/* VME_DATA_WIDTH */
+	u_int32	mapWhole;				/* MAP_WHOLE_BOARD */
+	u_int32	ctrlD32;				/* CTRL_ACCESS_D32 */
+	u_int32	adaptHigh;				/* IRQ_ADAPT_HIGH */
+	u_int32	adaptLow;				/* IRQ_ADAPT_LOW */
+	u_int32	adaptWin;				/* IRQ_ADAPT_WINDOW */
+	u_int32	stormWin;				/* IRQ_STORM_WINDOW */
+} A201_DESC_CFG;
+
 typedef struct
 {
     int32       ownMemSize;         /* own memory size */
@@ -140,13 +338,84 @@ typedef struct
     u_int32     hardAddr;           /* no conversion from bus to local view */
     void        *physAddr;          /* a201 physical address - local view */
     u_int32     dataWidth;          /* VMEbus data width */
+    u_int32     ctrlD32;            /* write ctrl+vector reg with one D32 */
 	                        /* mapped module control addresses - local view */
     void        *virtModCtrlAddr[A201_NBR_OF_SLOTS];    
+    void        *virtBrdAddr;       /* whole board mapped (MAP_WHOLE_BOARD) */
+    u_int32     mapLazy;            /* map control regs on first use */
+    u_int32     nbrOfRes;           /* number of assigned resources */
                                                           
     u_int8      irqVector[A201_NBR_OF_SLOTS];    	/* irq vectors */
     u_int8      irqLevel[A201_NBR_OF_SLOTS];    	/* irq levels */
     u_int8      irqPriority[A201_NBR_OF_SLOTS];    	/* irq priorities */
     u_int8      forceFound[A201_NBR_OF_SLOTS];    	/* forces that modue was found */
+    u_int8      irqPendChk[A201_NBR_OF_SLOTS];    	/* check irq pending bit */
+    u_int32     irqShared;          /* report shared irq mode */
+    u_int8      vectSlots[256];     /* slot mask per irq vector */
+    u_int32     prioDispatch;       /* priority dispatch (0=off) */
+    u_int32     prioOrder;          /* slots by priority, see PRIO_SLOT */
+    OSS_SPINL_HANDLE *regLock;      /* see REG_LOCK */
+    u_int16     ctrlShadow[A201_NBR_OF_SLOTS];    	/* control reg as written */
+    u_int16     vectShadow[A201_NBR_OF_SLOTS];    	/* vector reg as written */
+    u_int8      shadowValid[A201_NBR_OF_SLOTS];   	/* shadow matches hardware */
+    u_int8      mifaceSet[A201_NBR_OF_SLOTS];     	/* slot interface set up */
+    u_int8      pnpValid[A201_NBR_OF_SLOTS];      	/* pnp[] entry probed */
+    u_int8      pnpFull[A201_NBR_OF_SLOTS];       	/* devRev/devName read */
+    A201_SCAN_JOB scanJob[A201_NBR_OF_SLOTS];     	/* probe task per slot */
+    OSS_SEM_HANDLE *scanLock;       /* one scan pass at a time */
+    OSS_SEM_HANDLE *scanDone;       /* signaled when a scan pass ends */
+    void        *scanAddr;          /* board mapping of the scan pass */
+    u_int32     scanMask;           /* slots of the scan pass */
+    u_int32     scanRun;            /* slots running (+1 while starting) */
+    int32       scanStatus;         /* result of the last scan pass */
+    volatile u_int32 scanActive;    /* scan pass running */
+    A201_SLOT_INFO pnp[A201_NBR_OF_SLOTS];        	/* slot inventory cache */
+    u_int8      irqEnabled[A201_NBR_OF_SLOTS];    	/* irq enabled by driver */
+    u_int32     srvStamp[A201_NBR_OF_SLOTS];      	/* time of last SrvInit */
+#ifdef A201_HRTIME
+    u_int32     srvHrStamp[A201_NBR_OF_SLOTS];    	/* dto. (HR_STAMP) */
+#endif
+    A201_IRQ_STATS irqStats[A201_NBR_OF_SLOTS];   	/* interrupt statistics */
+#ifdef A201_HRTIME
+    A201_IRQ_HIST  irqHist[A201_NBR_OF_SLOTS];    	/* latency histograms */
+    u_int32     enaStamp[A201_NBR_OF_SLOTS];      	/* irq enable (HR_STAMP) */
+    u_int8      enaPending[A201_NBR_OF_SLOTS];    	/* wait for first irq */
+#endif
+    u_int32     stormLimit;         /* max irqs per storm window (0=off) */
+    u_int32     stormWinTicks;      /* storm window (ticks) */
+    u_int32     stormHoldoff;       /* holdoff time (ms) */
+    u_int32     stormStart[A201_NBR_OF_SLOTS];    	/* start of storm window */
+    u_int32     stormCnt[A201_NBR_OF_SLOTS];      	/* irqs in storm window */
+    u_int8      stormHeld[A201_NBR_OF_SLOTS];     	/* slot masked by holdoff */
+    A201_SLOT_ALARM stormAlm[A201_NBR_OF_SLOTS];  	/* holdoff alarms */
+    u_int8      pollMode[A201_NBR_OF_SLOTS];      	/* slot polled, irq off */
+    u_int8      pollReq[A201_NBR_OF_SLOTS];       	/* IRQ_POLL: poll once a
+                                                   	   signal is set */
+    OSS_SIG_HANDLE *pollSig[A201_NBR_OF_SLOTS];   	/* A201_IRQ_POLL_SIG */
+    int32       pollSigNbr[A201_NBR_OF_SLOTS];    	/* its signal number */
+    A201_POLL_STATS pollStats[A201_NBR_OF_SLOTS]; 	/* poll statistics */
+    u_int32     pollStart[A201_NBR_OF_SLOTS];     	/* start of poll mode */
+    OSS_ALARM_HANDLE *pollAlm;      /* cyclic poll alarm */
+    u_int32     pollPeriod;         /* poll period (ms) */
+    u_int32     pollTicks;          /* granted poll period (ticks) */
+    u_int32     pollLast;           /* time of last poll */
+    u_int32     pollRunning;        /* poll alarm started */
+    volatile u_int32 pollBusy;      /* poll in progress */
+    u_int32     pollWaiters;        /* tasks waiting for pollIdle */
+    OSS_SEM_HANDLE *pollIdle;       /* signaled when a poll ends */
+    u_int8      adaptive[A201_NBR_OF_SLOTS];      	/* adaptive irq/poll mode */
+    u_int32     adaptHigh[A201_NBR_OF_SLOTS];     	/* irqs/window to poll */
+    u_int32     adaptLow[A201_NBR_OF_SLOTS];      	/* hits/window to irq */
+    u_int32     adaptMark[A201_NBR_OF_SLOTS];     	/* count at window start */
+    u_int32     adaptWinTicks;      /* adaptive window (ticks) */
+    u_int32     adaptStart;         /* start of adaptive window */
+    A201_STATUS_PAGE *status;       /* status page (A201_MAP_OFFS_STATUS) */
+    void        *statusMem;         /* allocated status page memory */
+    u_int32     statusMemSize;      /* its size */
+    u_int32     ctrlMapCnt;         /* user mappings of the ctrl regs */
+    u_int32     statusMapCnt;       /* user mappings of the status page */
+    void        *a08Owner[A201_NBR_OF_SLOTS];     	/* A08 window owner */
+    u_int32     a08MapCnt[A201_NBR_OF_SLOTS];     	/* A08 window mappings */
 #ifdef _WIN_PCI2VME_BRIDGE_
     u_int8      irqWin[A201_NBR_OF_SLOTS];    		/* irq for windows */
 #endif
@@ -159,6 +428,16 @@ typedef struct
 #ifdef OSS_HAS_MAP_VME_ADDR
 	void		*addrWinHdl;		/* address window handle */ 
 #endif
+#ifdef A201_IRQ_TRACE
+	A201_TRACE_ENTRY trc[A201_NBR_OF_SLOTS][A201_TRACE_SIZE]; /* trace rings */
+	volatile u_int32 trcHead[A201_NBR_OF_SLOTS];	/* next write (producer) */
+	u_int32		trcTail[A201_NBR_OF_SLOTS];		/* next read (consumer) */
+	u_int32		trcLost[A201_NBR_OF_SLOTS];		/* overwritten since drain */
+#endif
+#ifdef A201_PERF_CNT
+	A201_PERF	perf;				/* entry point counters */
+	u_int32		perfFkt;			/* entry point of last call */
+#endif
 } A201_BRD_STRUCT;
 
 /*-----------------------------------------+
@@ -234,7 +513,94 @@ static int32 A201_GetStat(  BBIS_HANDLE     *brdHdl,
 static int32 A201_Unused( void );
 
 
+static int32 DescCfgKeys( A201_BRD_STRUCT *a201Hdl, DESC_HANDLE *descHdlP,
+						  A201_DESC_CFG *cfg );
+static int32 DescCfgBlob( A201_BRD_STRUCT *a201Hdl, DESC_HANDLE *descHdlP,
+						  A201_DESC_CFG *cfg );
 static int32 CfgInfoSlot( BBIS_HANDLE *brdHdl, va_list argptr );
+static int32 PnpProbe( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot,
+					   u_int32 full );
+static int32 PnpScan( A201_BRD_STRUCT *a201Hdl, u_int32 slotMask );
+static int32 PnpScanStart( A201_BRD_STRUCT *a201Hdl, u_int32 slotMask );
+static int32 PnpScanWait( A201_BRD_STRUCT *a201Hdl, int32 msec );
+static void PnpScanTask( void *arg );
+static void PnpScanEnd( A201_BRD_STRUCT *a201Hdl );
+static int32 PnpScanSlot( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot,
+						  void *virtBrdAddr );
+static int32 TaskStart( void (*fkt)( void *arg ), void *arg );
+static int32 PnpComplete( A201_BRD_STRUCT *a201Hdl );
+static void PnpRead( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot,
+					 void *virtModAddr, u_int32 full );
+static int32 PnpPrefetch( A201_BRD_STRUCT *a201Hdl );
+static void SlotRegsWrite( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot,
+						   u_int16 control, u_int16 vector );
+static int32 SlotIrqEnable( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot,
+							u_int32 enable );
+static void SlotIrqSet( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot,
+						u_int32 enable );
+static int32 SlotMap( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot );
+static int32 SlotIfaceSet( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot );
+static int32 SlotIfaceClr( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot );
+static void SlotUnmap( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot );
+static int32 CtrlRead( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot,
+					   u_int16 *ctrlP );
+static void VectTblBuild( A201_BRD_STRUCT *a201Hdl );
+static void PrioOrderBuild( A201_BRD_STRUCT *a201Hdl );
+static void StatusUpdate( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot );
+static int32 MapOpen( A201_BRD_STRUCT *a201Hdl, u_int32 offs,
+					  A201_MAP_REGION *reg );
+static int32 MapClose( A201_BRD_STRUCT *a201Hdl, u_int32 offs );
+static u_int32 MapCtrlSlot( u_int32 offs );
+static int32 A08Claim( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot,
+					   void *owner, A201_MAP_REGION *reg );
+static int32 A08Release( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot,
+						 void *owner );
+static int32 IrqReprogram( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot,
+						  int32 code, int32 value );
+static void StormCheck( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot );
+static void StormAlarm( void *arg );
+static int32 PollModeSet( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot,
+						  u_int32 poll );
+static void PollModeSwitch( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot,
+							u_int32 poll );
+static int32 PollUpdate( A201_BRD_STRUCT *a201Hdl );
+static int32 PollSigSet( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot,
+						 int32 signal );
+static void PollIdleWait( A201_BRD_STRUCT *a201Hdl );
+static int32 PollSlot( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot,
+					   u_int32 late );
+static void PollAlarm( void *arg );
+static void AdaptCheck( A201_BRD_STRUCT *a201Hdl );
+static int32 AdaptSet( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot,
+					   u_int32 adaptive );
+#ifdef A201_HRTIME
+static void HistAdd( u_int32 *bucket, u_int32 value );
+static u_int32 HistPercentile( const u_int32 *bucket, u_int32 pct );
+#endif
+#ifdef A201_IRQ_TRACE
+static void IrqTrace( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot,
+					  u_int8 event, u_int16 value );
+static int32 IrqTraceDrain( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot,
+							M_SG_BLOCK *blk );
+#endif
+
+#ifdef A201_CTRL_HOOK
+/* supplied by the environment the handler is linked into */
+extern void    A201_CtrlHookWrite( void *ctrlAddr, u_int32 offs, u_int16 val );
+extern u_int16 A201_CtrlHookRead( void *ctrlAddr, u_int32 offs );
+extern void    A201_CtrlHookWrite32( void *ctrlAddr, u_int32 offs, u_int32 val );
+#endif
+
+#ifdef A201_HRTIME
+/* supplied by the environment: free running counter and its frequency */
+extern u_int32 A201_HrStamp( void );
+extern u_int32 A201_HrStampHz( void );
+#endif
+
+#ifdef A201_TASK_HOOK
+/* supplied by the environment: runs fkt(arg) in a task of its own */
+extern int32 A201_TaskStart( void (*fkt)( void *arg ), void *arg );
+#endif
 
 /*****************************  A201_Ident  *********************************
  *
@@ -335,6 +701,22 @@ static char* A201_Ident( void )
  *                VME_A24_ADDR          (none)           see A201 description
  *                                                       base addr of module slot 0
  *
+ *                MAP_WHOLE_BOARD       0                0: map control regs per slot
+ *                                                       1: map whole board once
+ *                  map the whole A201_SIZE window with one mapping and
+ *                  derive control register and module window addresses
+ *
+ *                MAP_LAZY              0                0: map control regs at init
+ *                                                       1: map control regs of a
+ *                  slot on its first A201_SetMIface/A201_IrqEnable/
+ *                  BBIS_CFGINFO_SLOT, unmap on A201_ClrMIface
+ *                  (ignored with MAP_WHOLE_BOARD)
+ *
+ *                CTRL_ACCESS_D32       0                0: two D16 writes
+ *                                                       1: one D32 write
+ *                  update control and vector register of a slot with
+ *                  one D32 access (only with VME_DATA_WIDTH=3)
+ *
  *                IRQ_VECTOR            (none)           array of irq vectors
  *                                                       slot 0..4
  *
@@ -343,6 +725,7 @@ static char* A201_Ident( void )
  *
  *                IRQ_PRIORITY          0,0,0,0          array of irq priorities
  *                                                       slot 0..4
+ *                  Used by IRQ_PRIO_DISPATCH (polled slots only).
  *
  *                PNP_FORCE_FOUND		0,0,0,0			 array of "force found"
  *                                                       slot 0..4
@@ -350,6 +733,69 @@ static char* A201_Ident( void )
  *                  1: an M-Module will be reported for the slot
  *                     regardless if there is one plugged
  *
+ *                IRQ_PENDING_CHECK     0,0,0,0          array of "pending check"
+ *                                                       slot 0..4
+ *                  0: A201_IrqSrvInit returns BBIS_IRQ_UNK
+ *                  1: A201_IrqSrvInit reads the irq pending bit of the
+ *                     slot and returns BBIS_IRQ_YES/BBIS_IRQ_NO
+ *
+ *
+ *                IRQ_SHARED            0                0: BBIS_IRQ_EXCLUSIVE
+ *                                                       1: BBIS_IRQ_SHARED
+ *                  In shared mode, slots that share their vector with
+ *                  another slot of the board check the irq pending bit
+ *                  regardless of IRQ_PENDING_CHECK. If the vector is
+ *                  shared with other boards, IRQ_PENDING_CHECK must be set.
+ *
+ *                IRQ_PRIO_DISPATCH     0                0: off
+ *                                                       1..n: max. rescans
+ *                  Polled slots only (IRQ_POLL/A201_IRQ_POLL): the poll
+ *                  alarm services them in IRQ_PRIORITY order. After each
+ *                  service, the polled slots with higher priority are
+ *                  checked again, at most n times in a row, before lower
+ *                  priority slots are serviced.
+ *                  Interrupt driven slots are not affected: their order
+ *                  is decided by the VME interrupter (IRQ_LEVEL), and
+ *                  A201_IrqSrvInit neither orders them nor reads the
+ *                  pending bit for it (use IRQ_PENDING_CHECK).
+ *
+ *                IRQ_POLL              0,0,0,0          array of "polled mode"
+ *                                                       slot 0..4
+ *                  0: slot is interrupt driven
+ *                  1: slot irq stays disabled, the slot is polled
+ *                     as soon as a process registers its poll signal
+ *                     (A201_IRQ_POLL_SIG, see also A201_IRQ_POLL)
+ *
+ *                IRQ_POLL_PERIOD       1                poll period (ms)
+ *
+ *                IRQ_ADAPTIVE          0,0,0,0          array of "adaptive mode"
+ *                                                       slot 0..4
+ *                  0: slot mode is set by IRQ_POLL/A201_IRQ_POLL
+ *                  1: slot starts interrupt driven and switches to
+ *                     polled mode above IRQ_ADAPT_HIGH interrupts per
+ *                     window, back below IRQ_ADAPT_LOW pending polls
+ *
+ *                IRQ_ADAPT_HIGH        100              high water mark (irqs)
+ *
+ *                IRQ_ADAPT_LOW         10               low water mark (hits),
+ *                                                       < IRQ_ADAPT_HIGH
+ *
+ *                IRQ_ADAPT_WINDOW      100              adaptive window (ms)
+ *
+ *                IRQ_STORM_LIMIT       0                0: no storm protection
+ *                                                       1..n: max interrupts per
+ *                                                       IRQ_STORM_WINDOW and slot
+ *
+ *                IRQ_STORM_WINDOW      10               storm window (ms)
+ *
+ *                IRQ_STORM_HOLDOFF     100              time (ms) a storming slot
+ *                                                       stays masked
+ *
+ *                A201_CONFIG           (none)           binary configuration record
+ *                  (see bb_a201_codes.h) with all keys above except
+ *                  DEBUG_LEVEL_DESC. If present and valid, it is decoded
+ *                  in one pass and the single keys are not read.
+ *                  Otherwise the single keys are used.
  *
  *                If switch _WIN_PCI2VME_BRIDGE_ is set, the following additional
  *                descriptor keys will be used for windows.
@@ -379,14 +825,16 @@ static int32 A201_Init
     u_int32     gotsize;
     int32       retCode;
     void 		*physAddr;  	        /* a201 physical address - local view */
-    u_int32		temp;
     u_int32     a24Addr;    	    	/* a201 physical address A24 - VMEbus view*/
     u_int32     a16Addr;        		/* a201 physical address A16 - VMEbus view*/
     u_int32     dataWidth;          	/* VMEbus data width */
     u_int32     i;
+    u_int32     debugLevelDesc;
+    A201_DESC_CFG       cfg;            /* descriptor values */
+#ifdef _WIN_PCI2VME_BRIDGE_
     u_int8      defaultArr[A201_NBR_OF_SLOTS];
     u_int32     len;
-    u_int32     debugLevelDesc;
+#endif
     A201_BRD_STRUCT     *a201Hdl;
     DESC_HANDLE         *descHdlP;      /* descriptor handle pointer */
 
@@ -406,8 +854,10 @@ static int32 A201_Init
     /* fill turkey with 0 */
     OSS_MemFill( osHdl, gotsize, (char*) a201Hdl, 0 );
 
+#ifdef _WIN_PCI2VME_BRIDGE_
     /* fill defaultArr with 0 */
     OSS_MemFill( osHdl, sizeof(defaultArr), (char*)defaultArr, 0 );
+#endif
 
 	/* prepare debugging */
 	DBG_MYLEVEL = OSS_DBG_DEFAULT;	
@@ -415,6 +865,9 @@ static int32 A201_Init
 
     DBGWRT_1((DBH,"BB - A201_Init\n") );
 
+    PERF_CALL( a201Hdl, A201_PERF_INIT );
+    PERF_ALLOC( a201Hdl );
+
     /* store data into the board structure */
     a201Hdl->ownMemSize = gotsize;
     a201Hdl->osHdl = osHdl;
@@ -444,29 +897,19 @@ static int32 A201_Init
     if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) goto CLEANUP;
 	DESC_DbgLevelSet(descHdlP, debugLevelDesc);
 
-    /* get DEBUG_LEVEL */
-    retCode = DESC_GetUInt32( descHdlP, DBG_OFF, &a201Hdl->debugLevel,
-                             "DEBUG_LEVEL");
-    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) goto CLEANUP;
-
-    /* hard address use - no conversion from VME bus view to local view */
-    retCode = DESC_GetUInt32( descHdlP, 0, &temp, "PHYS_ADDR");
-    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) goto CLEANUP;
-	physAddr = (void*)(U_INT32_OR_64)temp;
-
-    /* A24 base address */
-    retCode = DESC_GetUInt32( descHdlP, 0, &a24Addr, "VME_A24_ADDR");
-    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) goto CLEANUP;
+    /* board configuration: binary record or single keys */
+    retCode = DescCfgBlob( a201Hdl, descHdlP, &cfg );
+    if( retCode == ERR_DESC_KEY_NOTFOUND )
+        retCode = DescCfgKeys( a201Hdl, descHdlP, &cfg );
+    if( retCode ) goto CLEANUP;
 
-    /* A16 base address */
-    retCode = DESC_GetUInt32( descHdlP, 0, &a16Addr, "VME_A16_ADDR");
-    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) goto CLEANUP;
+	physAddr  = (void*)(U_INT32_OR_64)cfg.physAddr;
+	a24Addr   = cfg.a24Addr;
+	a16Addr   = cfg.a16Addr;
+	dataWidth = cfg.dataWidth;
 
-    /* VMEbus data width */
-	if ((a24Addr || a16Addr) && 
-        (retCode = DESC_GetUInt32( descHdlP, 0, (u_int32*)(&dataWidth), 
-								  "VME_DATA_WIDTH")))
-		goto CLEANUP;
+    if( cfg.mapWhole )
+        a201Hdl->mapLazy = 0;
 
     /* check one of the addr must be defined */
     if( !physAddr && !a24Addr && !a16Addr )
@@ -542,37 +985,43 @@ static int32 A201_Init
     a201Hdl->physAddr = physAddr;
     a201Hdl->dataWidth = dataWidth;
 
-    /* irqVect of slot */
-	len = A201_NBR_OF_SLOTS;
-    retCode = DESC_GetBinary( descHdlP, defaultArr, len, a201Hdl->irqVector, 
-							 &len, "IRQ_VECTOR");
-    if( retCode != 0 || len != A201_NBR_OF_SLOTS )
+    /* D32 control access needs a D32 mapping */
+    if( cfg.ctrlD32 )
     {
-        DBGWRT_ERR((DBH," *** :DESC_GetBinary() IRQ_VECTOR ***\n") );
-        goto CLEANUP;
-    }/*if*/
+        if( a201Hdl->hardAddr == BBIS_BUS_TO_LOCAL && dataWidth == 3 )
+            a201Hdl->ctrlD32 = TRUE;
+        else
+        {
+            DBGWRT_ERR((DBH," *** %s_Init: CTRL_ACCESS_D32 ignored, "
+                        "needs VME_DATA_WIDTH=3\n", BBNAME) );
+        }/*if*/
+    }
 
-    /* irqLevel of slot */
-	len = A201_NBR_OF_SLOTS;
-    retCode = DESC_GetBinary( descHdlP, defaultArr, len, a201Hdl->irqLevel, 
-							 &len, "IRQ_LEVEL");
-    if( retCode != 0 || len != A201_NBR_OF_SLOTS )
+    if( cfg.adaptLow >= cfg.adaptHigh )
     {
-        DBGWRT_ERR((DBH," *** :DESC_GetBinary() IRQ_LEVEL ***\n") );
+        DBGWRT_ERR((DBH," *** %s_Init: IRQ_ADAPT_LOW >= IRQ_ADAPT_HIGH\n",
+                    BBNAME) );
+        retCode = ERR_BBIS_DESC_PARAM;
         goto CLEANUP;
     }/*if*/
 
-    /* irqPriority of slot (optional) */
-	len = A201_NBR_OF_SLOTS;
-    retCode = DESC_GetBinary( descHdlP, defaultArr, len, a201Hdl->irqPriority, 
-							 &len, "IRQ_PRIORITY");
-    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) goto CLEANUP;
+    for( i=0; i<A201_NBR_OF_SLOTS; i++ )
+    {
+        a201Hdl->adaptHigh[i] = cfg.adaptHigh;
+        a201Hdl->adaptLow[i]  = cfg.adaptLow;
+        /* adaptive slots start interrupt driven */
+        if( a201Hdl->adaptive[i] )
+            a201Hdl->pollReq[i] = 0;
+    }/*for*/
 
-    /* PNP_FORCE_FOUND (optional) */
-	len = A201_NBR_OF_SLOTS;
-    retCode = DESC_GetBinary( descHdlP, defaultArr, len, a201Hdl->forceFound, 
-							 &len, "PNP_FORCE_FOUND");
-    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) goto CLEANUP;
+    a201Hdl->adaptWinTicks = cfg.adaptWin * OSS_TickRateGet( osHdl ) / 1000;
+    if( a201Hdl->adaptWinTicks == 0 )
+        a201Hdl->adaptWinTicks = 1;
+
+    /* window in ticks, at least one tick */
+    a201Hdl->stormWinTicks = cfg.stormWin * OSS_TickRateGet( osHdl ) / 1000;
+    if( a201Hdl->stormWinTicks == 0 )
+        a201Hdl->stormWinTicks = 1;
 
 /* descriptor parameters required by windows (if PCI2VME bridge) */
 #ifdef _WIN_PCI2VME_BRIDGE_
@@ -592,6 +1041,9 @@ static int32 A201_Init
     }/*if*/
 #endif
 
+    VectTblBuild( a201Hdl );
+    PrioOrderBuild( a201Hdl );
+
     /* exit descHdl */
     retCode = DESC_Exit( &descHdlP );
     if( retCode )
@@ -604,16 +1056,26 @@ static int32 A201_Init
     | assign the resources       |
     +----------------------------*/
     /* store memmory addresses in resource struct */
-	for( i=0; i<A201_NBR_OF_SLOTS; i++ ) {
-		a201Hdl->res[i].type = OSS_RES_MEM;
-		a201Hdl->res[i].u.mem.physAddr = (void*) 
-			((u_int8*)physAddr + A201_CTRL_REG_1 + i * 0x200);
-		a201Hdl->res[i].u.mem.size = A201_CTRL_REG_SIZE;
+	if( cfg.mapWhole ) {
+		/* one resource for the whole board */
+		a201Hdl->res[0].type = OSS_RES_MEM;
+		a201Hdl->res[0].u.mem.physAddr = physAddr;
+		a201Hdl->res[0].u.mem.size = A201_SIZE;
+		a201Hdl->nbrOfRes = 1;
+	}
+	else {
+		for( i=0; i<A201_NBR_OF_SLOTS; i++ ) {
+			a201Hdl->res[i].type = OSS_RES_MEM;
+			a201Hdl->res[i].u.mem.physAddr = (void*) 
+				((u_int8*)physAddr + A201_CTRL_REG_1 + i * 0x200);
+			a201Hdl->res[i].u.mem.size = A201_CTRL_REG_SIZE;
+		}
+		a201Hdl->nbrOfRes = A201_NBR_OF_RESOURCES;
 	}
 
 	/* assign the resources */
     retCode = OSS_AssignResources(osHdl, A201_BUSTYPE, a201Hdl->busNbr, 
-								  A201_NBR_OF_RESOURCES, a201Hdl->res);
+								  a201Hdl->nbrOfRes, a201Hdl->res);
     if (retCode) {
 		DBGWRT_ERR((DBH," *** %s_Init: OSS_AssignResources() failed (0x%x)\n",
 					BBNAME,retCode));
@@ -621,9 +1083,127 @@ static int32 A201_Init
     }
 	a201Hdl->resourcesAssigned = TRUE;
 
+    /*----------------------------------------+
+    | create storm holdoff alarms             |
+    +----------------------------------------*/
+    if( a201Hdl->stormLimit )
+    {
+        for( i=0; i<A201_NBR_OF_SLOTS; i++ )
+        {
+            a201Hdl->stormAlm[i].brdHdl = a201Hdl;
+            a201Hdl->stormAlm[i].mSlot  = i;
+            retCode = OSS_AlarmCreate( osHdl, StormAlarm, &a201Hdl->stormAlm[i],
+                                       &a201Hdl->stormAlm[i].alarmHdl );
+            if( retCode )
+            {
+                DBGWRT_ERR((DBH," *** %s_Init: OSS_AlarmCreate() failed\n",
+                            BBNAME) );
+                goto CLEANUP;
+            }/*if*/
+            PERF_ALLOC( a201Hdl );
+        }/*for*/
+    }/*if*/
+
+    /*----------------------------------------+
+    | create register lock                    |
+    +----------------------------------------*/
+    retCode = OSS_SpinLockCreate( osHdl, &a201Hdl->regLock );
+    if( retCode )
+    {
+        DBGWRT_ERR((DBH," *** %s_Init: OSS_SpinLockCreate() failed\n",
+                    BBNAME) );
+        goto CLEANUP;
+    }/*if*/
+    PERF_ALLOC( a201Hdl );
+
+    /*----------------------------------------+
+    | alloc status page                       |
+    +----------------------------------------*/
+    /*
+     * The page is mapped to user space (A201_CFGINFO_MAP_OPEN), so it must
+     * not share a page with the handle: allocate one page of slack and
+     * align the pointer.
+     */
+    a201Hdl->statusMem = OSS_MemGet( osHdl, A201_STATUS_SIZE + A201_PAGE_SIZE,
+                                     &a201Hdl->statusMemSize );
+    if( a201Hdl->statusMem == NULL )
+    {
+        DBGWRT_ERR((DBH," *** %s_Init: no memory for status page\n",
+                    BBNAME) );
+        retCode = ERR_OSS_MEM_ALLOC;
+        goto CLEANUP;
+    }/*if*/
+    PERF_ALLOC( a201Hdl );
+    OSS_MemFill( osHdl, a201Hdl->statusMemSize, (char*)a201Hdl->statusMem, 0 );
+    a201Hdl->status = (A201_STATUS_PAGE*)
+        ( ((U_INT32_OR_64)a201Hdl->statusMem + A201_PAGE_SIZE - 1) &
+          ~(U_INT32_OR_64)(A201_PAGE_SIZE - 1) );
+    a201Hdl->status->nbrOfSlots = A201_NBR_OF_SLOTS;
+
+    /*----------------------------------------+
+    | create poll alarm                       |
+    +----------------------------------------*/
+    retCode = OSS_AlarmCreate( osHdl, PollAlarm, a201Hdl, &a201Hdl->pollAlm );
+    if( retCode )
+    {
+        DBGWRT_ERR((DBH," *** %s_Init: OSS_AlarmCreate() failed\n", BBNAME) );
+        goto CLEANUP;
+    }/*if*/
+    PERF_ALLOC( a201Hdl );
+
+    retCode = OSS_SemCreate( osHdl, OSS_SEM_COUNT, 0, &a201Hdl->pollIdle );
+    if( retCode )
+    {
+        DBGWRT_ERR((DBH," *** %s_Init: OSS_SemCreate() failed\n", BBNAME) );
+        goto CLEANUP;
+    }/*if*/
+
+    /*----------------------------------------+
+    | create PnP scan semaphores              |
+    +----------------------------------------*/
+    if( (retCode = OSS_SemCreate( osHdl, OSS_SEM_BIN, 1,
+                                  &a201Hdl->scanLock )) ||
+        (retCode = OSS_SemCreate( osHdl, OSS_SEM_BIN, 0,
+                                  &a201Hdl->scanDone )) )
+    {
+        DBGWRT_ERR((DBH," *** %s_Init: OSS_SemCreate() failed\n", BBNAME) );
+        goto CLEANUP;
+    }/*if*/
+
+
+    for( i=0; i<A201_NBR_OF_SLOTS; i++ )
+        a201Hdl->pollStart[i] = A201_TIMESTAMP( a201Hdl );
+
     /*----------------------------------------+
     | compute and map control and vector reg  |
     +----------------------------------------*/
+    if( cfg.mapWhole )
+    {
+        retCode = OSS_MapPhysToVirtAddr( osHdl, physAddr, A201_SIZE,
+										 A201_ADDRSPACE,
+                                         A201_BUSTYPE,
+                                         a201Hdl->busNbr,
+                                         &a201Hdl->virtBrdAddr );
+        DBGWRT_2((DBH,"   board mapped to 0x%08x\n", a201Hdl->virtBrdAddr ) );
+        if( retCode )
+        {
+            DBGWRT_ERR((DBH," *** %s_Init: OSS_MapPhysToVirtAddr() failed\n",
+						BBNAME) );
+            goto CLEANUP;
+        }/*if*/
+        PERF_ALLOC( a201Hdl );
+
+        for( i=0; i<A201_NBR_OF_SLOTS; i++ )
+            a201Hdl->virtModCtrlAddr[i] = (void*)
+                ((u_int8*)a201Hdl->virtBrdAddr + A201_CTRL_REG_1 + i * 0x200);
+
+        return( retCode );
+    }/*if*/
+
+    /* slots are mapped by SlotMap */
+    if( a201Hdl->mapLazy )
+        return( retCode );
+
     for( i=0; i<A201_NBR_OF_SLOTS; i++ )
     {
         retCode = OSS_MapPhysToVirtAddr( osHdl,
@@ -642,6 +1222,7 @@ static int32 A201_Init
 						BBNAME) );
             goto CLEANUP;
         }/*if*/
+        PERF_ALLOC( a201Hdl );
     }/*for*/
 
 
@@ -661,6 +1242,13 @@ CLEANUP:
  *  Description:  Initializes the base board.
  *                (control = 0x00 and vector = 0xff register)
  *
+ *                If the handler can start tasks (A201_TASK_HOOK, Linux),
+ *                starts a PnP scan pass that reads the M-Module ID-PROMs
+ *                into the slot inventory cache, so the slow EEPROM
+ *                accesses overlap with the system start (PnpPrefetch).
+ *                Queries of the slot inventory wait for the pass (see
+ *                also A201_PNP_WAIT).
+ *
  *---------------------------------------------------------------------------
  *  Input......:  brdHdl   pointer to board handle structure
  *  Output.....:  0 | error code
@@ -671,14 +1259,26 @@ static int32 A201_BrdInit
     BBIS_HANDLE     *brdHdl
 )
 {
-    DBGCMD( A201_BRD_STRUCT  *a201Hdl = (A201_BRD_STRUCT*)brdHdl; )
+    A201_BRD_STRUCT  *a201Hdl = (A201_BRD_STRUCT*)brdHdl;
+
     DBGWRT_1( (DBH,"BB - %s_BrdInit\n",BBNAME) );
+    PERF_CALL( a201Hdl, A201_PERF_BRDINIT );
 
     /*------------------------------+
     | identify board with EEPROM Id |
     +-------------------------------*/
     /* there is no id-prom */
 
+    /*------------------------------+
+    | prefetch M-Module ID-PROMs    |
+    +-------------------------------*/
+    /* not fatal: the slots are probed on demand then */
+    if( PnpPrefetch( a201Hdl ) )
+    {
+        DBGWRT_ERR((DBH," *** %s_BrdInit: ID-PROM prefetch not started\n",
+                    BBNAME) );
+    }/*if*/
+
     /*------------------------------+
     | init global registers         |
     +-------------------------------*/
@@ -703,8 +1303,13 @@ static int32 A201_BrdExit
     BBIS_HANDLE     *brdHdl
 )
 {
-    DBGCMD( A201_BRD_STRUCT  *a201Hdl = (A201_BRD_STRUCT*)brdHdl; )
+    A201_BRD_STRUCT  *a201Hdl = (A201_BRD_STRUCT*)brdHdl;
+
     DBGWRT_1( (DBH,"BB - %s_BrdExit\n",BBNAME) );
+    PERF_CALL( a201Hdl, A201_PERF_BRDEXIT );
+
+    /* wait for the probe tasks of a PnP scan (or ID-PROM prefetch) */
+    PnpScanWait( a201Hdl, OSS_SEM_WAITFOREVER );
 
     /*------------------------------+
     | cleanup global registers      |
@@ -738,22 +1343,84 @@ static int32 A201_Exit
     u_int32         i;
 
     DBGWRT_1( (DBH,"BB - %s_Exit\n",BBNAME) );
+    PERF_CALL( a201Hdl, A201_PERF_EXIT );
+
 
     /*----------------------------------------+
-    | unmap control and vector reg            |
+    | wait for PnP scan tasks                 |
+    +----------------------------------------*/
+    if( a201Hdl->scanDone )
+    {
+        PnpScanWait( a201Hdl, OSS_SEM_WAITFOREVER );
+        OSS_SemRemove( a201Hdl->osHdl, &a201Hdl->scanDone );
+    }/*if*/
+
+    if( a201Hdl->scanLock )
+        OSS_SemRemove( a201Hdl->osHdl, &a201Hdl->scanLock );
+
+    /*----------------------------------------+
+    | remove alarms                           |
     +----------------------------------------*/
     for( i=0; i<A201_NBR_OF_SLOTS; i++ )
     {
-        if( a201Hdl->virtModCtrlAddr[i] )
-           OSS_UnMapVirtAddr( a201Hdl->osHdl, &a201Hdl->virtModCtrlAddr[i],
-							A201_CTRL_REG_SIZE, A201_ADDRSPACE );
+        if( a201Hdl->stormAlm[i].alarmHdl )
+            OSS_AlarmRemove( a201Hdl->osHdl, &a201Hdl->stormAlm[i].alarmHdl );
     }/*for*/
 
+    if( a201Hdl->pollAlm )
+        OSS_AlarmRemove( a201Hdl->osHdl, &a201Hdl->pollAlm );
+
+    if( a201Hdl->pollIdle )
+        OSS_SemRemove( a201Hdl->osHdl, &a201Hdl->pollIdle );
+
+    /* signals of slots never released (A201_ClrMIface) */
+    for( i=0; i<A201_NBR_OF_SLOTS; i++ )
+    {
+        if( a201Hdl->pollSig[i] )
+            OSS_SigRemove( a201Hdl->osHdl, &a201Hdl->pollSig[i] );
+    }/*for*/
+
+    if( a201Hdl->regLock )
+        OSS_SpinLockRemove( a201Hdl->osHdl, &a201Hdl->regLock );
+
+    /*
+     * The OS layer must close all user mappings first. A status page
+     * still mapped is left allocated rather than handed back for reuse.
+     */
+    if( a201Hdl->ctrlMapCnt || a201Hdl->statusMapCnt )
+    {
+        DBGWRT_ERR((DBH," *** %s_Exit: still mapped to user space "
+                    "(ctrl %d, status %d)\n", BBNAME, a201Hdl->ctrlMapCnt,
+                    a201Hdl->statusMapCnt) );
+    }/*if*/
+
+    if( a201Hdl->statusMem && !a201Hdl->statusMapCnt )
+        OSS_MemFree( a201Hdl->osHdl, a201Hdl->statusMem,
+                     a201Hdl->statusMemSize );
+
+    /*----------------------------------------+
+    | unmap control and vector reg            |
+    +----------------------------------------*/
+    if( a201Hdl->virtBrdAddr )
+    {
+        OSS_UnMapVirtAddr( a201Hdl->osHdl, &a201Hdl->virtBrdAddr,
+                           A201_SIZE, A201_ADDRSPACE );
+    }
+    else
+    {
+        for( i=0; i<A201_NBR_OF_SLOTS; i++ )
+        {
+            if( a201Hdl->virtModCtrlAddr[i] )
+               OSS_UnMapVirtAddr( a201Hdl->osHdl, &a201Hdl->virtModCtrlAddr[i],
+								A201_CTRL_REG_SIZE, A201_ADDRSPACE );
+        }/*for*/
+    }/*if*/
+
 #ifdef OSS_HAS_UNASSIGN_RESOURCES
 	if( a201Hdl->resourcesAssigned ){
 		/* unassign the resources */
 		OSS_UnAssignResources( a201Hdl->osHdl, OSS_BUSTYPE_VME,a201Hdl->busNbr,
-							   A201_NBR_OF_RESOURCES, a201Hdl->res );
+							   a201Hdl->nbrOfRes, a201Hdl->res );
 	}
 #endif /* OSS_HAS_UNASSIGN_RESOURCES */
 
@@ -947,12 +1614,19 @@ static int32 A201_BrdInfo
  *                BBIS_CFGINFO_IRQ          interrupt parameters
  *                BBIS_CFGINFO_EXP          exception interrupt parameters
  *                BBIS_CFGINFO_SLOT			slot information
+ *                A201_CFGINFO_SLOT_ALL     information of all slots
+ *                A201_CFGINFO_VECT_SLOTS   slots using an irq vector
+ *                A201_CFGINFO_MAP_OPEN     user mapping made
+ *                A201_CFGINFO_MAP_CLOSE    user mapping gone
+ *                A201_CFGINFO_A08_CLAIM    A08 window mapped
+ *                A201_CFGINFO_A08_RELEASE  A08 window unmapped
  *
  *                The BBIS_CFGINFO_BUSNBR code returns the number of the
  *                bus on which the board resides.
  *
  *                The BBIS_CFGINFO_IRQ code returns the device interrupt
  *                vector, level and mode of the specified device.
+ *                The mode is BBIS_IRQ_SHARED if IRQ_SHARED is set.
  *
  *                The BBIS_CFGINFO_EXP code returns the exception interrupt
  *                vector, level and mode of the specified device.
@@ -962,6 +1636,46 @@ static int32 A201_BrdInfo
  *                The slot is occupied or empty, the device id and device
  *                revision of the plugged device, the name of the slot and
  *                the name of the plugged device.
+ *                The slot is probed on the first query only, further
+ *                queries are served from the slot inventory cache
+ *                (see A201_PNP_INVALIDATE/A201_PNP_RESCAN).
+ *
+ *                The A201_CFGINFO_SLOT_ALL code fills an A201_SLOT_INFO
+ *                array with the information of all slots. Uncached slots
+ *                are probed in one pass with one mapping.
+ *                  arg2  u_int32 *nbrP         in:  entries in infoP
+ *                                              out: number of slots
+ *                  arg3  A201_SLOT_INFO *infoP slot information
+ *
+ *                The A201_CFGINFO_VECT_SLOTS code returns the mask of
+ *                slots programmed to an irq vector. It allows a shared
+ *                interrupt handler to find the slots to service without
+ *                calling A201_IrqSrvInit for every slot.
+ *                  arg2  u_int32 vector        irq vector 0..255
+ *                  arg3  u_int32 *slotMaskP    bit n set: slot n uses vector
+ *
+ *                The A201_CFGINFO_MAP_OPEN code is called by the OS layer
+ *                (kernel only) when it maps a region of A201_BLK_MAP_INFO
+ *                to user space. It returns the region behind the mmap
+ *                offset and counts the mapping. A201_CFGINFO_MAP_CLOSE
+ *                must be called when the mapping is gone. The control
+ *                registers of a slot are refused (ERR_BBIS_ILL_FUNC) if
+ *                their page is not free of other registers and windows.
+ *                  arg2  u_int32 offs          A201_MAP_OFFS_xxx
+ *                  arg3  A201_MAP_REGION *regP region (MAP_OPEN only)
+ *
+ *                The A201_CFGINFO_A08_CLAIM code is called by the OS layer
+ *                (kernel only) when it maps the A08 window of a slot to
+ *                user space. The owner is the OS layer's handle of the
+ *                device that maps the window; a window mapped by one
+ *                device cannot be claimed by another. It returns the
+ *                window region. A201_CFGINFO_A08_RELEASE must be called
+ *                with the same owner when the mapping is gone. The slot
+ *                interface must be set up; A201_ClrMIface drops claims
+ *                left over.
+ *                  arg2  u_int32 mSlot         module slot number
+ *                  arg3  void *owner           OS layer device handle
+ *                  arg4  A201_MAP_REGION *regP region (A08_CLAIM only)
  *
  *---------------------------------------------------------------------------
  *  Input......:  brdHdl    pointer to board handle structure       
@@ -984,6 +1698,7 @@ static int32 A201_CfgInfo
 
     retCode = 0;
     DBGWRT_1((DBH,"BB - %s_CfgInfo\n",BBNAME) );
+    PERF_CALL( a201Hdl, A201_PERF_CFGINFO );
 
     va_start(argptr,code);
 
@@ -1012,7 +1727,8 @@ static int32 A201_CfgInfo
             *vectorP = a201Hdl->irqVector[mSlot];
             *levelP  = a201Hdl->irqLevel[mSlot];
 #endif
-            *modeP   = BBIS_IRQ_EXCLUSIVE;
+            *modeP   = a201Hdl->irqShared ? BBIS_IRQ_SHARED :
+                                            BBIS_IRQ_EXCLUSIVE;
             break;
         }
 
@@ -1039,13 +1755,80 @@ static int32 A201_CfgInfo
 			break;
 		}
 
-        default:
-            DBGWRT_ERR((DBH," *** %s_CfgInfo: code=0x%x not supported\n",
-						BBNAME,code));
-            retCode = ERR_BBIS_UNK_CODE;
-    }/*switch*/
+		/* information of all slots */
+		case A201_CFGINFO_SLOT_ALL:
+		{
+			u_int32        *nbrP  = va_arg( argptr, u_int32* );
+			A201_SLOT_INFO *infoP = va_arg( argptr, A201_SLOT_INFO* );
 
-    va_end( argptr );
+			if( *nbrP < A201_NBR_OF_SLOTS ){
+				retCode = ERR_BBIS_ILL_PARAM;
+				break;
+			}
+
+			if( (retCode = PnpComplete( a201Hdl )) )
+				break;
+
+			OSS_MemCopy( a201Hdl->osHdl, sizeof(a201Hdl->pnp),
+						 (char*)a201Hdl->pnp, (char*)infoP );
+			*nbrP = A201_NBR_OF_SLOTS;
+			break;
+		}
+
+		/* slots using a vector */
+		case A201_CFGINFO_VECT_SLOTS:
+		{
+			u_int32 vector     = va_arg( argptr, u_int32 );
+			u_int32 *slotMaskP = va_arg( argptr, u_int32* );
+
+			*slotMaskP = a201Hdl->vectSlots[vector & 0xff];
+			break;
+		}
+
+		/* user space mappings (kernel only) */
+		case A201_CFGINFO_MAP_OPEN:
+		{
+			u_int32         offs = va_arg( argptr, u_int32 );
+			A201_MAP_REGION *regP = va_arg( argptr, A201_MAP_REGION* );
+
+			retCode = MapOpen( a201Hdl, offs, regP );
+			break;
+		}
+
+		case A201_CFGINFO_MAP_CLOSE:
+		{
+			u_int32 offs = va_arg( argptr, u_int32 );
+
+			retCode = MapClose( a201Hdl, offs );
+			break;
+		}
+
+		/* A08 window mappings (kernel only) */
+		case A201_CFGINFO_A08_CLAIM:
+		case A201_CFGINFO_A08_RELEASE:
+		{
+			u_int32 mSlot = va_arg( argptr, u_int32 );
+			void    *owner = va_arg( argptr, void* );
+
+			if( mSlot >= A201_NBR_OF_SLOTS ){
+				retCode = ERR_BBIS_ILL_SLOT;
+				break;
+			}
+			if( code == A201_CFGINFO_A08_CLAIM )
+				retCode = A08Claim( a201Hdl, mSlot, owner,
+									va_arg( argptr, A201_MAP_REGION* ) );
+			else
+				retCode = A08Release( a201Hdl, mSlot, owner );
+			break;
+		}
+
+        default:
+            DBGWRT_ERR((DBH," *** %s_CfgInfo: code=0x%x not supported\n",
+						BBNAME,code));
+            retCode = ERR_BBIS_UNK_CODE;
+    }/*switch*/
+
+    va_end( argptr );
     return( retCode );
 }/*A201_CfgInfo*/
 
@@ -1055,6 +1838,9 @@ static int32 A201_CfgInfo
  *  Description:  En/disable interrupt for module slot 'mSlot' and
  *                writes vector and control register
  *
+ *                Register writes are skipped if the value is already
+ *                on the hardware (see SlotRegsWrite).
+ *
  *---------------------------------------------------------------------------
  *  Input......:  brdHdl    pointer to board handle structure
  *                mSlot     module slot number
@@ -1069,27 +1855,18 @@ static int32 A201_IrqEnable
     u_int32         enable
 )
 {
-    u_int16          control = 0;
     A201_BRD_STRUCT  *a201Hdl = (A201_BRD_STRUCT*)brdHdl;
 
 
     DBGWRT_1( (DBH,"BB - %s_IrqEnable: slot=%d enable=%d\n", 
 			   BBNAME,mSlot, enable) );
 
+    PERF_CALL( a201Hdl, A201_PERF_IRQENABLE );
+
     if (mSlot >= A201_NBR_OF_SLOTS)
         return( ERR_BBIS_ILL_SLOT );
 
-    control = a201Hdl->irqLevel[mSlot];
-
-    if( enable )
-    {
-       control |=  A201_CTRL_IRQ_ENABLE;          /* enable irq */
-    }/*if*/
-
-    MWRITE_D16( (a201Hdl->virtModCtrlAddr[mSlot]), A201_VECT_OFFS, a201Hdl->irqVector[mSlot] );
-    MWRITE_D16( (a201Hdl->virtModCtrlAddr[mSlot]), A201_CTRL_OFFS, control );
-
-    return( 0 );
+    return( SlotIrqEnable( a201Hdl, mSlot, enable ) );
 }/*A201_IrqEnable*/
 
 
@@ -1098,11 +1875,21 @@ static int32 A201_IrqEnable
  *  Description:  This function is called at the beginning of an interrupt
  *                handler.
  *
+ *                If IRQ_PENDING_CHECK is set for the slot, the irq pending
+ *                bit of the slot's control register decides if the
+ *                interrupt was caused by the slot. Otherwise the state
+ *                is unknown.
+ *                In shared mode (IRQ_SHARED), the pending bit is also
+ *                checked if other slots of the board use the same vector.
+ *
+ *                IRQ_PRIO_DISPATCH only orders polled slots, it does not
+ *                turn on the pending check here.
+ *
  *---------------------------------------------------------------------------
  *  Input......:  brdHdl    pointer to board handle structure
  *                mSlot     module slot number
  *
- *  Output.....:  return    BBIS_IRQ_UNK
+ *  Output.....:  return    BBIS_IRQ_UNK | BBIS_IRQ_YES | BBIS_IRQ_NO
  *
  *  Globals....:  ---
  ****************************************************************************/
@@ -1112,10 +1899,57 @@ static int32 A201_IrqSrvInit
     u_int32         mSlot
 )
 {
-    DBGCMD( A201_BRD_STRUCT  *a201Hdl = (A201_BRD_STRUCT*)brdHdl );
-    DBGWRT_1( (DBH,"BB - %s_IrqSrvInit: slot=%d\n", BBNAME,mSlot) );
+    A201_BRD_STRUCT  *a201Hdl = (A201_BRD_STRUCT*)brdHdl;
+    A201_IRQ_STATS   *stats = &a201Hdl->irqStats[mSlot];
+    int32            irqState = BBIS_IRQ_UNK;
+    u_int32          perfSave;
+    u_int16          ctrl;
+
+    ISR_DBGWRT_1( (DBH,"BB - %s_IrqSrvInit: slot=%d\n", BBNAME,mSlot) );
+    PERF_ENTER( a201Hdl, A201_PERF_IRQSRVINIT, perfSave );
+
+    a201Hdl->srvStamp[mSlot] = A201_TIMESTAMP( a201Hdl );
+#ifdef A201_HRTIME
+    a201Hdl->srvHrStamp[mSlot] = HR_STAMP();
+
+    /* first interrupt after enable */
+    if( a201Hdl->enaPending[mSlot] )
+    {
+        HistAdd( a201Hdl->irqHist[mSlot].enaDelay,
+                 a201Hdl->srvHrStamp[mSlot] - a201Hdl->enaStamp[mSlot] );
+        a201Hdl->enaPending[mSlot] = FALSE;
+    }/*if*/
+#endif
+    stats->irqCount++;
 
-    return( BBIS_IRQ_UNK );
+    if( a201Hdl->irqPendChk[mSlot] ||
+        (a201Hdl->irqShared &&
+         VECT_SHARED( a201Hdl->vectSlots[a201Hdl->irqVector[mSlot]] )) )
+    {
+        if( CtrlRead( a201Hdl, mSlot, &ctrl ) &&
+            (ctrl & A201_CTRL_IRQ_PENDING) )
+            irqState = BBIS_IRQ_YES;
+        else
+            irqState = BBIS_IRQ_NO;
+    }
+    /* unmapped slot (MAP_LAZY) has its irq disabled */
+    else if( !a201Hdl->virtModCtrlAddr[mSlot] )
+        irqState = BBIS_IRQ_NO;
+
+    switch( irqState )
+    {
+        case BBIS_IRQ_YES: stats->irqYes++; break;
+        case BBIS_IRQ_NO:  stats->irqNo++;  break;
+        default:           stats->irqUnk++; break;
+    }/*switch*/
+
+    if( a201Hdl->stormLimit && irqState != BBIS_IRQ_NO )
+        StormCheck( a201Hdl, mSlot );
+
+    IRQ_TRACE( a201Hdl, mSlot, A201_TRC_SRVINIT, (u_int16)irqState );
+
+    PERF_LEAVE( a201Hdl, perfSave );
+    return( irqState );
 }/*A201_IrqSrvInit*/
 
 
@@ -1136,8 +1970,23 @@ static void A201_IrqSrvExit
     u_int32         mSlot
 )
 {
-    DBGCMD( A201_BRD_STRUCT  *a201Hdl = (A201_BRD_STRUCT*)brdHdl; )
-    DBGWRT_1( (DBH,"BB - %s_IrqSrvExit: slot=%d\n", BBNAME,mSlot) );
+    A201_BRD_STRUCT  *a201Hdl = (A201_BRD_STRUCT*)brdHdl;
+    u_int32          perfSave;
+#ifdef A201_HRTIME
+    u_int32          srvTime;
+#endif
+
+    ISR_DBGWRT_1( (DBH,"BB - %s_IrqSrvExit: slot=%d\n", BBNAME,mSlot) );
+    PERF_ENTER( a201Hdl, A201_PERF_IRQSRVEXIT, perfSave );
+    IRQ_TRACE( a201Hdl, mSlot, A201_TRC_SRVEXIT, 0 );
+
+#ifdef A201_HRTIME
+    srvTime = HR_STAMP() - a201Hdl->srvHrStamp[mSlot];
+    a201Hdl->irqStats[mSlot].srvTime += srvTime;
+    HistAdd( a201Hdl->irqHist[mSlot].srvTime, srvTime );
+#endif
+
+    PERF_LEAVE( a201Hdl, perfSave );
 }/*A201_IrqSrvExit*/
 
 
@@ -1212,8 +2061,10 @@ static int32 A201_SetMIface
 )
 {
     A201_BRD_STRUCT *a201Hdl = (A201_BRD_STRUCT*)brdHdl;
+    int32           error;
 
     DBGWRT_1( (DBH,"BB - %s_SetMIface: slot=%d\n", BBNAME, mSlot) );
+    PERF_CALL( a201Hdl, A201_PERF_SETMIFACE );
 
     if (mSlot >= A201_NBR_OF_SLOTS)
         return( ERR_BBIS_ILL_SLOT );
@@ -1248,15 +2099,18 @@ static int32 A201_SetMIface
         return( ERR_BBIS_ILL_ADDRMODE );
     }/*if*/
 
+    /*
+     * PnP scan tasks (and the ID-PROM prefetch) set up and clear the
+     * slot interface. A pass takes about one ID-PROM read, give up if
+     * it hangs.
+     */
+    if( (error = PnpScanWait( a201Hdl, A201_PNP_IFACE_TOUT )) )
+        return( error );
+
     /*------------------------------+
     | init slot registers           |
     +-------------------------------*/
-    /* disable interrupts / default vector */
-    MWRITE_D16( (a201Hdl->virtModCtrlAddr[mSlot]), A201_CTRL_OFFS, A201_CTRL_DEFAULT );
-    MWRITE_D16( (a201Hdl->virtModCtrlAddr[mSlot]), A201_VECT_OFFS, A201_VECT_DEFAULT );
-
-    /* all was ok */
-    return( 0 );
+    return( SlotIfaceSet( a201Hdl, mSlot ) );
 }/*A201_SetMIface*/
 
 
@@ -1279,19 +2133,18 @@ static int32 A201_ClrMIface
     A201_BRD_STRUCT *a201Hdl = (A201_BRD_STRUCT*)brdHdl;
 
     DBGWRT_1( (DBH,"BB - %s_ClrMIface: slot=%d\n", BBNAME,mSlot) );
+    PERF_CALL( a201Hdl, A201_PERF_CLRMIFACE );
 
     if (mSlot >= A201_NBR_OF_SLOTS)
         return( ERR_BBIS_ILL_SLOT );
 
+    /* no poll signal may be sent after the slot is released */
+    PollSigSet( a201Hdl, mSlot, 0 );
+
     /*------------------------------+
     | cleanup slot registers        |
     +-------------------------------*/
-    /* disable interrupts / default vector */
-    MWRITE_D16( (a201Hdl->virtModCtrlAddr[mSlot]), A201_CTRL_OFFS, A201_CTRL_DEFAULT );
-    MWRITE_D16( (a201Hdl->virtModCtrlAddr[mSlot]), A201_VECT_OFFS, A201_VECT_DEFAULT );
-
-    /* all was ok */
-    return( 0 );
+    return( SlotIfaceClr( a201Hdl, mSlot ) );
 }/*A201_ClrMIface*/
 
 
@@ -1328,6 +2181,7 @@ static int32 A201_GetMAddr
     A201_BRD_STRUCT *a201Hdl = (A201_BRD_STRUCT*)brdHdl;
 
     DBGWRT_1( (DBH,"BB - %s_GetMAddr: slot=%d\n", BBNAME, mSlot) );
+    PERF_CALL( a201Hdl, A201_PERF_GETMADDR );
 
     if (mSlot >= A201_NBR_OF_SLOTS)
         return( ERR_BBIS_ILL_SLOT );
@@ -1380,6 +2234,26 @@ static int32 A201_GetMAddr
  *
  *     supported  codes                     values
  *                M_BB_DEBUG_LEVEL          see oss.h
+ *                M_BB_IRQ_VECT             0..255
+ *                M_BB_IRQ_LEVEL            0..7
+ *                M_BB_IRQ_PRIORITY         0..255
+ *                A201_IRQ_ENABLE_MASK      bit 15..8: slot mask
+ *                                          bit  7..0: enable mask
+ *                                          (slot interfaces set up)
+ *                A201_IRQ_POLL             0=interrupt, 1=polled (signal set)
+ *                A201_IRQ_POLL_SIG         signal number, 0=none
+ *                A201_IRQ_ADAPTIVE         0=off, 1=adaptive irq/poll
+ *                A201_IRQ_ADAPT_HIGH       irqs per window
+ *                A201_IRQ_ADAPT_LOW        hits per window
+ *                A201_REG_RESYNC           -
+ *                A201_PNP_INVALIDATE       -
+ *                A201_PNP_RESCAN           -
+ *                A201_PNP_SCAN             slot mask (0=all slots),
+ *                                          returns when started
+ *                A201_PNP_WAIT             timeout (ms), -1=endless
+ *                A201_IRQ_STATS_RESET      -
+ *                A201_IRQ_HIST_RESET       -    (A201_HRTIME only)
+ *                A201_PERF_RESET           -    (A201_PERF_CNT only)
  *
  *---------------------------------------------------------------------------
  *
@@ -1406,6 +2280,7 @@ static int32 A201_SetStat
 
     DBGWRT_1((DBH,"BB - %s_SetStat: mSlot=%d code=0x%04x\n", BBNAME,
 			  mSlot, code) );
+    PERF_CALL( a201Hdl, A201_PERF_SETSTAT );
 
     if (mSlot >= A201_NBR_OF_SLOTS)
         return( ERR_BBIS_ILL_SLOT );
@@ -1417,6 +2292,153 @@ static int32 A201_SetStat
             a201Hdl->debugLevel = value;
             break;
 
+        /* change irq vector/level */
+        case M_BB_IRQ_VECT:
+        case M_BB_IRQ_LEVEL:
+            return( IrqReprogram( a201Hdl, mSlot, code, value ) );
+
+        /* en/disable interrupts of several slots */
+        /* (all slots must be set up, nothing is changed otherwise) */
+        case A201_IRQ_ENABLE_MASK:
+        {
+            u_int32 slotMask = ((u_int32)value >> 8) & 0xff;
+            u_int32 i;
+
+            if( slotMask >> A201_NBR_OF_SLOTS )
+                return( ERR_BBIS_ILL_PARAM );
+
+            for( i=0; i<A201_NBR_OF_SLOTS; i++ )
+                if( (slotMask & (1 << i)) && !a201Hdl->mifaceSet[i] ){
+                    DBGWRT_ERR((DBH," *** %s_SetStat: irq enable mask, slot %d "
+                                "interface not set up\n", BBNAME, i) );
+                    return( ERR_BBIS_ILL_PARAM );
+                }
+
+            REG_LOCK( a201Hdl );
+            for( i=0; i<A201_NBR_OF_SLOTS; i++ )
+                if( slotMask & (1 << i) )
+                    SlotIrqSet( a201Hdl, i, value & (1 << i) );
+            REG_UNLOCK( a201Hdl );
+            break;
+        }
+
+        /* switch between interrupt driven and polled mode */
+        case A201_IRQ_POLL:
+            if( value == 1 && !a201Hdl->pollSig[mSlot] ){
+                DBGWRT_ERR((DBH," *** %s_SetStat: no poll signal for "
+                            "slot %d\n", BBNAME, mSlot) );
+                return( ERR_BBIS_ILL_PARAM );
+            }
+            if( (u_int32)value > 1 )
+                return( ERR_BBIS_ILL_PARAM );
+            a201Hdl->pollReq[mSlot] = (u_int8)value;
+            return( PollModeSet( a201Hdl, mSlot, value ) );
+
+        /* install/remove the poll signal of the calling process */
+        case A201_IRQ_POLL_SIG:
+            return( PollSigSet( a201Hdl, mSlot, value ) );
+
+        /* adaptive irq/poll switching */
+        case A201_IRQ_ADAPTIVE:
+            return( AdaptSet( a201Hdl, mSlot, value ) );
+
+        case A201_IRQ_ADAPT_HIGH:
+            if( value <= 0 || (u_int32)value <= a201Hdl->adaptLow[mSlot] )
+                return( ERR_BBIS_ILL_PARAM );
+            a201Hdl->adaptHigh[mSlot] = value;
+            break;
+
+        case A201_IRQ_ADAPT_LOW:
+            if( value < 0 || (u_int32)value >= a201Hdl->adaptHigh[mSlot] )
+                return( ERR_BBIS_ILL_PARAM );
+            a201Hdl->adaptLow[mSlot] = value;
+            break;
+
+        /* change irq priority */
+        case M_BB_IRQ_PRIORITY:
+            if( value < 0 || value > 0xff )
+                return( ERR_BBIS_ILL_PARAM );
+            REG_LOCK( a201Hdl );
+            a201Hdl->irqPriority[mSlot] = (u_int8)value;
+            PrioOrderBuild( a201Hdl );
+            REG_UNLOCK( a201Hdl );
+            break;
+
+        /* drop cached slot inventory entry */
+        case A201_PNP_INVALIDATE:
+        {
+            int32 error;
+
+            if( (error = PnpScanWait( a201Hdl, OSS_SEM_WAITFOREVER )) )
+                return( error );
+            a201Hdl->pnpValid[mSlot] = FALSE;
+            a201Hdl->pnpFull[mSlot]  = FALSE;
+            break;
+        }
+
+        /* probe slot again */
+        case A201_PNP_RESCAN:
+        {
+            int32 error;
+
+            if( (error = PnpScanWait( a201Hdl, OSS_SEM_WAITFOREVER )) )
+                return( error );
+            return( PnpProbe( a201Hdl, mSlot, TRUE ) );
+        }
+
+        /*
+         * start probing several slots at the same time, don't wait;
+         * the slot inventory codes wait for the end
+         */
+        case A201_PNP_SCAN:
+            return( PnpScanStart( a201Hdl, value ? (u_int32)value :
+                                  (1 << A201_NBR_OF_SLOTS) - 1 ) );
+
+        /* wait for a scan pass/prefetch (value=timeout ms, -1=endless) */
+        case A201_PNP_WAIT:
+            return( PnpScanWait( a201Hdl, (int32)value ) );
+
+        /* clear interrupt statistics of all slots */
+        case A201_IRQ_STATS_RESET:
+            OSS_MemFill( a201Hdl->osHdl, sizeof(a201Hdl->irqStats),
+                         (char*)a201Hdl->irqStats, 0 );
+            OSS_MemFill( a201Hdl->osHdl, sizeof(a201Hdl->pollStats),
+                         (char*)a201Hdl->pollStats, 0 );
+            {
+                u_int32 i;
+
+                for( i=0; i<A201_NBR_OF_SLOTS; i++ ){
+                    a201Hdl->pollStart[i] = A201_TIMESTAMP( a201Hdl );
+                    a201Hdl->adaptMark[i] = 0;
+                }
+            }
+            break;
+
+        /* clear latency histograms of the slot */
+#ifdef A201_HRTIME
+        case A201_IRQ_HIST_RESET:
+            OSS_MemFill( a201Hdl->osHdl, sizeof(A201_IRQ_HIST),
+                         (char*)&a201Hdl->irqHist[mSlot], 0 );
+            break;
+#endif
+
+        /* rewrite shadowed control/vector registers to the hardware */
+        case A201_REG_RESYNC:
+            REG_LOCK( a201Hdl );
+            a201Hdl->shadowValid[mSlot] = FALSE;
+            SlotRegsWrite( a201Hdl, mSlot, a201Hdl->ctrlShadow[mSlot],
+                           a201Hdl->vectShadow[mSlot] );
+            REG_UNLOCK( a201Hdl );
+            break;
+
+#ifdef A201_PERF_CNT
+        /* reset entry point counters */
+        case A201_PERF_RESET:
+            OSS_MemFill( a201Hdl->osHdl, sizeof(a201Hdl->perf),
+                         (char*)&a201Hdl->perf, 0 );
+            break;
+#endif
+
         /* unknown */
         default:
             return( ERR_BBIS_UNK_CODE );
@@ -1436,7 +2458,26 @@ static int32 A201_SetStat
  *                M_BB_IRQ_PRIORITY			0..255
  *                M_BB_ID_CHECK             0
  *                M_BB_DEBUG_LEVEL          see oss.h
+ *                A201_IRQ_COUNT            0..0xffffffff
+ *                A201_IRQ_CLAIMED          0..0xffffffff
+ *                A201_IRQ_UNKNOWN          0..0xffffffff
+ *                A201_IRQ_TOGGLES          0..0xffffffff
+ *                A201_IRQ_SRVTIME          0..0xffffffff (A201_HRTIME only)
+ *                A201_IRQ_POLL             0=interrupt, 1=polled
+ *                A201_IRQ_ADAPTIVE         0=off, 1=adaptive irq/poll
+ *                A201_IRQ_ADAPT_HIGH       irqs per window
+ *                A201_IRQ_ADAPT_LOW        hits per window
+ *                A201_SLOT_OCCUPIED        BBIS_SLOT_OCCUP_YES/NO
  *                M_MK_BLK_REV_ID           -
+ *                A201_BLK_PNP_INVENTORY    A201_SLOT_INFO[nbrOfSlots]
+ *                A201_BLK_IRQ_STATS        A201_IRQ_STATS[nbrOfSlots]
+ *                A201_BLK_IRQ_HIST         A201_IRQ_HIST (A201_HRTIME only)
+ *                A201_BLK_POLL_STATS       A201_POLL_STATS
+ *                A201_BLK_MAP_INFO         A201_MAP_INFO
+ *                A201_BLK_A08_INFO         A201_A08_INFO
+ *                A201_BLK_IRQ_TRACE        A201_TRACE_HDR, A201_TRACE_ENTRY[]
+ *                                          (A201_IRQ_TRACE only)
+ *                A201_BLK_PERF             A201_PERF    (A201_PERF_CNT only)
  *
  *---------------------------------------------------------------------------
  *
@@ -1463,6 +2504,7 @@ static int32 A201_GetStat
 
     DBGWRT_1((DBH,"BB - %s_GetStat: mSlot=%d code=0x%04x\n", BBNAME, 
 			  mSlot, code) );
+    PERF_CALL( a201Hdl, A201_PERF_GETSTAT );
 
     if (mSlot >= A201_NBR_OF_SLOTS)
         return( ERR_BBIS_ILL_SLOT );
@@ -1497,6 +2539,79 @@ static int32 A201_GetStat
             *valueP = a201Hdl->debugLevel;
             break;
 
+        /*------------------+
+        |  irq statistics   |
+        +------------------*/
+        case A201_IRQ_COUNT:
+            *valueP = a201Hdl->irqStats[mSlot].irqCount;
+            break;
+
+        case A201_IRQ_CLAIMED:
+            *valueP = a201Hdl->irqStats[mSlot].irqYes;
+            break;
+
+        case A201_IRQ_UNKNOWN:
+            *valueP = a201Hdl->irqStats[mSlot].irqUnk;
+            break;
+
+        case A201_IRQ_TOGGLES:
+            *valueP = a201Hdl->irqStats[mSlot].enables +
+                      a201Hdl->irqStats[mSlot].disables;
+            break;
+
+#ifdef A201_HRTIME
+        case A201_IRQ_SRVTIME:
+            *valueP = a201Hdl->irqStats[mSlot].srvTime;
+            break;
+#endif
+
+        /*------------------+
+        |  polled mode      |
+        +------------------*/
+        case A201_IRQ_POLL:
+            *valueP = a201Hdl->pollMode[mSlot];
+            break;
+
+        case A201_IRQ_POLL_SIG:
+            *valueP = a201Hdl->pollSigNbr[mSlot];
+            break;
+
+        case A201_IRQ_ADAPTIVE:
+            *valueP = a201Hdl->adaptive[mSlot];
+            break;
+
+        case A201_IRQ_ADAPT_HIGH:
+            *valueP = a201Hdl->adaptHigh[mSlot];
+            break;
+
+        case A201_IRQ_ADAPT_LOW:
+            *valueP = a201Hdl->adaptLow[mSlot];
+            break;
+
+        /*------------------+
+        |  slot occupancy   |
+        +------------------*/
+        /*
+         * reads only magic word and module id, for hot swap polling;
+         * a slot in use by a driver is not touched
+         */
+        case A201_SLOT_OCCUPIED:
+        {
+            int32 error;
+
+            if( a201Hdl->forceFound[mSlot] || a201Hdl->mifaceSet[mSlot] ){
+                *valueP = BBIS_SLOT_OCCUP_YES;
+                break;
+            }
+
+            if( (error = PnpScanWait( a201Hdl, OSS_SEM_WAITFOREVER )) ||
+                (error = PnpProbe( a201Hdl, mSlot, FALSE )) )
+                return error;
+
+            *valueP = a201Hdl->pnp[mSlot].occupied;
+            break;
+        }
+
         /*------------------+
         |  id check enabled |
         +------------------*/
@@ -1511,6 +2626,187 @@ static int32 A201_GetStat
            *value32_or_64P = (INT32_OR_64)&a201Hdl->idFuncTbl;
            break;
 
+        /*--------------------+
+        |  slot inventory     |
+        +--------------------*/
+        case A201_BLK_PNP_INVENTORY:
+        {
+            M_SG_BLOCK *blk = (M_SG_BLOCK*)value32_or_64P;
+            int32      error;
+
+            if( blk->size < (int32)sizeof(a201Hdl->pnp) )
+                return ERR_BBIS_ILL_PARAM;
+
+            if( (error = PnpComplete( a201Hdl )) )
+                return error;
+
+            OSS_MemCopy( a201Hdl->osHdl, sizeof(a201Hdl->pnp),
+                         (char*)a201Hdl->pnp, (char*)blk->data );
+            blk->size = sizeof(a201Hdl->pnp);
+            break;
+        }
+
+        /*--------------------+
+        |  irq statistics     |
+        +--------------------*/
+        case A201_BLK_IRQ_STATS:
+        {
+            M_SG_BLOCK *blk = (M_SG_BLOCK*)value32_or_64P;
+
+            if( blk->size < (int32)sizeof(a201Hdl->irqStats) )
+                return ERR_BBIS_ILL_PARAM;
+
+            OSS_MemCopy( a201Hdl->osHdl, sizeof(a201Hdl->irqStats),
+                         (char*)a201Hdl->irqStats, (char*)blk->data );
+#ifdef A201_HRTIME
+            {
+                A201_IRQ_STATS *stats = (A201_IRQ_STATS*)blk->data;
+                u_int32        i;
+
+                for( i=0; i<A201_NBR_OF_SLOTS; i++ )
+                    stats[i].stampHz = A201_HrStampHz();
+            }
+#endif
+            blk->size = sizeof(a201Hdl->irqStats);
+            break;
+        }
+
+#ifdef A201_HRTIME
+        /*--------------------+
+        |  latency histogram  |
+        +--------------------*/
+        case A201_BLK_IRQ_HIST:
+        {
+            M_SG_BLOCK    *blk = (M_SG_BLOCK*)value32_or_64P;
+            A201_IRQ_HIST *hist = (A201_IRQ_HIST*)blk->data;
+
+            if( blk->size < (int32)sizeof(A201_IRQ_HIST) )
+                return ERR_BBIS_ILL_PARAM;
+
+            OSS_MemCopy( a201Hdl->osHdl, sizeof(A201_IRQ_HIST),
+                         (char*)&a201Hdl->irqHist[mSlot], (char*)hist );
+
+            /* percentiles from the copy */
+            hist->srvP50 = HistPercentile( hist->srvTime, 50 );
+            hist->srvP90 = HistPercentile( hist->srvTime, 90 );
+            hist->srvP99 = HistPercentile( hist->srvTime, 99 );
+            hist->enaP50 = HistPercentile( hist->enaDelay, 50 );
+            hist->enaP90 = HistPercentile( hist->enaDelay, 90 );
+            hist->enaP99 = HistPercentile( hist->enaDelay, 99 );
+            hist->stampHz = A201_HrStampHz();
+
+            blk->size = sizeof(A201_IRQ_HIST);
+            break;
+        }
+#endif
+
+        /*--------------------+
+        |  poll statistics    |
+        +--------------------*/
+        case A201_BLK_POLL_STATS:
+        {
+            M_SG_BLOCK      *blk = (M_SG_BLOCK*)value32_or_64P;
+            A201_POLL_STATS *ps = (A201_POLL_STATS*)blk->data;
+            u_int32         elapsed, hz;
+
+            if( blk->size < (int32)sizeof(A201_POLL_STATS) )
+                return ERR_BBIS_ILL_PARAM;
+
+            OSS_MemCopy( a201Hdl->osHdl, sizeof(A201_POLL_STATS),
+                         (char*)&a201Hdl->pollStats[mSlot], (char*)ps );
+
+            /* achieved rate since poll start/reset (avoids 64 bit math) */
+            elapsed = A201_TIMESTAMP( a201Hdl ) - a201Hdl->pollStart[mSlot];
+            hz      = OSS_TickRateGet( a201Hdl->osHdl );
+            ps->rate = 0;
+            if( elapsed ){
+                ps->rate = ps->polls / elapsed * hz;
+                if( elapsed <= 0xffffffff / hz )
+                    ps->rate += (ps->polls % elapsed) * hz / elapsed;
+            }
+
+            blk->size = sizeof(A201_POLL_STATS);
+            break;
+        }
+
+        /*--------------------+
+        |  mapping info       |
+        +--------------------*/
+        /*
+         * For an OS layer that maps the control registers and the status
+         * page to user space. Only mmap offsets are returned; the OS
+         * layer gets the regions with A201_CFGINFO_MAP_OPEN.
+         * The control registers of slot n (A201_CTRL_REG_SIZE bytes,
+         * read only) are at mmap offset ctrlOffs + n*ctrlStride.
+         */
+        case A201_BLK_MAP_INFO:
+        {
+            M_SG_BLOCK    *blk = (M_SG_BLOCK*)value32_or_64P;
+            A201_MAP_INFO *mi = (A201_MAP_INFO*)blk->data;
+
+            if( blk->size < (int32)sizeof(A201_MAP_INFO) )
+                return ERR_BBIS_ILL_PARAM;
+
+            mi->ctrlOffs   = A201_MAP_OFFS_CTRL;
+            mi->ctrlSize   = A201_CTRL_REG_SIZE;
+            mi->ctrlStride = A201_MAP_CTRL_STRIDE;
+            mi->nbrOfSlots = A201_NBR_OF_SLOTS;
+            mi->statusOffs = A201_MAP_OFFS_STATUS;
+            mi->statusSize = A201_STATUS_SIZE;
+
+            blk->size = sizeof(A201_MAP_INFO);
+            break;
+        }
+
+        /*--------------------+
+        |  A08 window         |
+        +--------------------*/
+        /*
+         * Mappings of the slot's A08 window, made by the OS layer with
+         * A201_CFGINFO_A08_CLAIM.
+         */
+        case A201_BLK_A08_INFO:
+        {
+            M_SG_BLOCK    *blk = (M_SG_BLOCK*)value32_or_64P;
+            A201_A08_INFO *ai = (A201_A08_INFO*)blk->data;
+
+            if( blk->size < (int32)sizeof(A201_A08_INFO) )
+                return ERR_BBIS_ILL_PARAM;
+
+            ai->size   = A201_M_A08_SIZE;
+            ai->mapCnt = a201Hdl->a08MapCnt[mSlot];
+
+            blk->size = sizeof(A201_A08_INFO);
+            break;
+        }
+
+#ifdef A201_IRQ_TRACE
+        /*--------------------+
+        |  interrupt trace    |
+        +--------------------*/
+        case A201_BLK_IRQ_TRACE:
+            return( IrqTraceDrain( a201Hdl, mSlot,
+                                   (M_SG_BLOCK*)value32_or_64P ) );
+#endif
+
+#ifdef A201_PERF_CNT
+        /*--------------------+
+        |  entry counters     |
+        +--------------------*/
+        case A201_BLK_PERF:
+        {
+            M_SG_BLOCK *blk = (M_SG_BLOCK*)value32_or_64P;
+
+            if( blk->size < (int32)sizeof(A201_PERF) )
+                return ERR_BBIS_ILL_PARAM;
+
+            OSS_MemCopy( a201Hdl->osHdl, sizeof(A201_PERF),
+                         (char*)&a201Hdl->perf, (char*)blk->data );
+            blk->size = sizeof(A201_PERF);
+            break;
+        }
+#endif
+
         /* unknown */
         default:
             return ERR_BBIS_UNK_CODE;
@@ -1538,52 +2834,287 @@ static int32 A201_Unused
     return( ERR_BBIS_ILL_FUNC );
 }/*A201_Unused*/
 
-/********************************* CfgInfoSlot ******************************
- *
- *  Description:  Fulfils the BB_CfgInfo(BBIS_CFGINFO_SLOT) request
- * 
- *				  The variable-argument list (argptr) contains the following
- *                parameters in the given order:
- *
- *                Input
- *                -----
- *                mSlot (u_int32) - device slot number  
- *
- *                Output
- *                ------
- *                occupied (u_int32*) - occupied information
- *                 - pluggable device: 
- *                   BBIS_SLOT_OCCUP_YES if slot is occupied
- *                   or BBIS_SLOT_OCCUP_NO if slot is empty
- *                 - onboard device: 
- *                   BBIS_SLOT_OCCUP_ALW if device is enabled
- *                   or BBIS_SLOT_OCCUP_DIS if device is disabled
+/******************************* DescCfgKeys ********************************
  *
- *                devId (u_int32*) - device id (4-byte hex value)
- *                  The device id should identify the type of the device
- *                  but should not contain enough information to differentiate
- *                  between two identical devices. If the device id is unknown
- *                  BBIS_SLOT_NBR_UNK must be returned. 
- *                  - M-Module:
- *                    id-prom-magic-word << 16 | id-prom-module-id
- *                    Example: 0x53460024
- *                    Note: The returned device id must be identical to the
- *                          "autoid" value in the device drivers xml file.  
+ *  Description:  Reads the board configuration from single descriptor keys
  *
- *                devRev (u_int32*) - device revision (4-byte hex value)
- *                  - M-Module: id-prom-layout-revision << 16 |
- *                              id-prom-product-variant
- *                              example: 0x01091400       
- *                    or BBIS_SLOT_NBR_UNK if device revision is unknown
+ *                Values that A201_Init processes further are returned in
+ *                'cfg', all others are stored in the board handle.
  *
- *                slotName (char*) - slot name
- *                  The slot name should consist of the slot type and the
- *                  slot label but must not contain any non-printing
- *                  characters.
- *                  The length of the returned string, including the
- *                  terminating null character, must not exceed
- *                  BBIS_SLOT_STR_MAXSIZE.
- *                  format : "<slot type> <slot label>"
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 descHdlP		descriptor handle
+ *  Output.....: cfg			configuration values
+ *				 return			error code
+ *  Globals....: -
+ ****************************************************************************/
+static int32 DescCfgKeys(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl,
+	DESC_HANDLE *descHdlP,
+	A201_DESC_CFG *cfg )
+{
+    int32       retCode;
+    u_int8      defaultArr[A201_NBR_OF_SLOTS];
+    u_int32     len;
+
+    OSS_MemFill( a201Hdl->osHdl, sizeof(defaultArr), (char*)defaultArr, 0 );
+
+    /* get DEBUG_LEVEL */
+    retCode = DESC_GetUInt32( descHdlP, DBG_OFF, &a201Hdl->debugLevel,
+                             "DEBUG_LEVEL");
+    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) return( retCode );
+
+    /* hard address use - no conversion from VME bus view to local view */
+    retCode = DESC_GetUInt32( descHdlP, 0, &cfg->physAddr, "PHYS_ADDR");
+    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) return( retCode );
+
+    /* A24 base address */
+    retCode = DESC_GetUInt32( descHdlP, 0, &cfg->a24Addr, "VME_A24_ADDR");
+    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) return( retCode );
+
+    /* A16 base address */
+    retCode = DESC_GetUInt32( descHdlP, 0, &cfg->a16Addr, "VME_A16_ADDR");
+    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) return( retCode );
+
+    /* VMEbus data width */
+	if ((cfg->a24Addr || cfg->a16Addr) && 
+        (retCode = DESC_GetUInt32( descHdlP, 0, &cfg->dataWidth, 
+								  "VME_DATA_WIDTH")))
+		return( retCode );
+
+    /* one mapping for the whole board (optional) */
+    retCode = DESC_GetUInt32( descHdlP, 0, &cfg->mapWhole, "MAP_WHOLE_BOARD");
+    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) return( retCode );
+
+    /* map control registers on first use (optional) */
+    retCode = DESC_GetUInt32( descHdlP, 0, &a201Hdl->mapLazy, "MAP_LAZY");
+    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) return( retCode );
+
+    /* D32 access to control+vector register (optional) */
+    retCode = DESC_GetUInt32( descHdlP, 0, &cfg->ctrlD32, "CTRL_ACCESS_D32");
+    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) return( retCode );
+
+    /* irqVect of slot */
+	len = A201_NBR_OF_SLOTS;
+    retCode = DESC_GetBinary( descHdlP, defaultArr, len, a201Hdl->irqVector, 
+							 &len, "IRQ_VECTOR");
+    if( retCode != 0 || len != A201_NBR_OF_SLOTS )
+    {
+        DBGWRT_ERR((DBH," *** :DESC_GetBinary() IRQ_VECTOR ***\n") );
+        return( retCode ? retCode : ERR_BBIS_DESC_PARAM );
+    }/*if*/
+
+    /* irqLevel of slot */
+	len = A201_NBR_OF_SLOTS;
+    retCode = DESC_GetBinary( descHdlP, defaultArr, len, a201Hdl->irqLevel, 
+							 &len, "IRQ_LEVEL");
+    if( retCode != 0 || len != A201_NBR_OF_SLOTS )
+    {
+        DBGWRT_ERR((DBH," *** :DESC_GetBinary() IRQ_LEVEL ***\n") );
+        return( retCode ? retCode : ERR_BBIS_DESC_PARAM );
+    }/*if*/
+
+    /* irqPriority of slot (optional) */
+	len = A201_NBR_OF_SLOTS;
+    retCode = DESC_GetBinary( descHdlP, defaultArr, len, a201Hdl->irqPriority, 
+							 &len, "IRQ_PRIORITY");
+    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) return( retCode );
+
+    /* PNP_FORCE_FOUND (optional) */
+	len = A201_NBR_OF_SLOTS;
+    retCode = DESC_GetBinary( descHdlP, defaultArr, len, a201Hdl->forceFound, 
+							 &len, "PNP_FORCE_FOUND");
+    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) return( retCode );
+
+    /* IRQ_PENDING_CHECK (optional) */
+	len = A201_NBR_OF_SLOTS;
+    retCode = DESC_GetBinary( descHdlP, defaultArr, len, a201Hdl->irqPendChk, 
+							 &len, "IRQ_PENDING_CHECK");
+    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) return( retCode );
+
+    /* IRQ_SHARED (optional) */
+    retCode = DESC_GetUInt32( descHdlP, 0, &a201Hdl->irqShared, "IRQ_SHARED");
+    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) return( retCode );
+
+    /* priority dispatch (optional) */
+    retCode = DESC_GetUInt32( descHdlP, 0, &a201Hdl->prioDispatch,
+                              "IRQ_PRIO_DISPATCH");
+    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) return( retCode );
+
+    /* polled mode (optional) */
+	len = A201_NBR_OF_SLOTS;
+    retCode = DESC_GetBinary( descHdlP, defaultArr, len, a201Hdl->pollReq,
+							 &len, "IRQ_POLL");
+    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) return( retCode );
+
+    retCode = DESC_GetUInt32( descHdlP, 1, &a201Hdl->pollPeriod,
+                              "IRQ_POLL_PERIOD");
+    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) return( retCode );
+
+    /* adaptive irq/poll mode (optional) */
+	len = A201_NBR_OF_SLOTS;
+    retCode = DESC_GetBinary( descHdlP, defaultArr, len, a201Hdl->adaptive,
+							 &len, "IRQ_ADAPTIVE");
+    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) return( retCode );
+
+    retCode = DESC_GetUInt32( descHdlP, 100, &cfg->adaptHigh, "IRQ_ADAPT_HIGH");
+    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) return( retCode );
+
+    retCode = DESC_GetUInt32( descHdlP, 10, &cfg->adaptLow, "IRQ_ADAPT_LOW");
+    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) return( retCode );
+
+    retCode = DESC_GetUInt32( descHdlP, 100, &cfg->adaptWin, "IRQ_ADAPT_WINDOW");
+    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) return( retCode );
+
+    /* interrupt storm protection (optional) */
+    retCode = DESC_GetUInt32( descHdlP, 0, &a201Hdl->stormLimit,
+                              "IRQ_STORM_LIMIT");
+    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) return( retCode );
+
+    retCode = DESC_GetUInt32( descHdlP, 10, &cfg->stormWin, "IRQ_STORM_WINDOW");
+    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) return( retCode );
+
+    retCode = DESC_GetUInt32( descHdlP, 100, &a201Hdl->stormHoldoff,
+                              "IRQ_STORM_HOLDOFF");
+    if( retCode != 0 && retCode != ERR_DESC_KEY_NOTFOUND ) return( retCode );
+
+    return( 0 );
+}
+
+/******************************* DescCfgBlob ********************************
+ *
+ *  Description:  Decodes the binary board configuration record A201_CONFIG
+ *
+ *                The record (see bb_a201_codes.h) is checked for magic,
+ *                version, number of slots, length and checksum and then
+ *                decoded in one pass. Values that A201_Init processes
+ *                further are returned in 'cfg', all others are stored in
+ *                the board handle.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 descHdlP		descriptor handle
+ *  Output.....: cfg			configuration values
+ *				 return			0 | ERR_DESC_KEY_NOTFOUND if there is no
+ *								record (use DescCfgKeys) |
+ *								ERR_BBIS_DESC_PARAM if it is invalid
+ *  Globals....: -
+ ****************************************************************************/
+static int32 DescCfgBlob(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl,
+	DESC_HANDLE *descHdlP,
+	A201_DESC_CFG *cfg )
+{
+	u_int8	blob[A201_CFG_SIZE(A201_NBR_OF_SLOTS)];
+	u_int8	*p;
+	u_int32	len = sizeof(blob), i;
+	u_int16	sum = 0;
+	int32	error;
+
+	error = DESC_GetBinary( descHdlP, blob, 0, blob, &len, "A201_CONFIG" );
+	if( error == ERR_DESC_KEY_NOTFOUND )
+		return error;
+	if( error && error != ERR_DESC_BUF_TOOSMALL )
+		return error;
+
+	if( error || len != sizeof(blob) ||
+		CFG_GET16( blob ) != A201_CFG_MAGIC ||
+		blob[2] != A201_CFG_VERSION ||
+		blob[3] != A201_NBR_OF_SLOTS ||
+		CFG_GET16( blob+4 ) != sizeof(blob) ){
+		DBGWRT_ERR((DBH," *** %s DescCfgBlob: A201_CONFIG invalid\n",
+					BBNAME) );
+		return ERR_BBIS_DESC_PARAM;
+	}
+
+	for( i=A201_CFG_HDR_SIZE; i<len; i++ )
+		sum = (u_int16)(sum + blob[i]);
+
+	if( sum != CFG_GET16( blob+6 ) ){
+		DBGWRT_ERR((DBH," *** %s DescCfgBlob: A201_CONFIG checksum "
+					"error\n", BBNAME) );
+		return ERR_BBIS_DESC_PARAM;
+	}
+
+	/* values in A201_CFG_xxx order */
+	p = blob + A201_CFG_HDR_SIZE;
+	a201Hdl->debugLevel    = CFG_GET32( p ); p += 4;
+	cfg->physAddr          = CFG_GET32( p ); p += 4;
+	cfg->a24Addr           = CFG_GET32( p ); p += 4;
+	cfg->a16Addr           = CFG_GET32( p ); p += 4;
+	cfg->dataWidth         = CFG_GET32( p ); p += 4;
+	cfg->mapWhole          = CFG_GET32( p ); p += 4;
+	a201Hdl->mapLazy       = CFG_GET32( p ); p += 4;
+	cfg->ctrlD32           = CFG_GET32( p ); p += 4;
+	a201Hdl->irqShared     = CFG_GET32( p ); p += 4;
+	a201Hdl->prioDispatch  = CFG_GET32( p ); p += 4;
+	a201Hdl->pollPeriod    = CFG_GET32( p ); p += 4;
+	cfg->adaptHigh         = CFG_GET32( p ); p += 4;
+	cfg->adaptLow          = CFG_GET32( p ); p += 4;
+	cfg->adaptWin          = CFG_GET32( p ); p += 4;
+	a201Hdl->stormLimit    = CFG_GET32( p ); p += 4;
+	cfg->stormWin          = CFG_GET32( p ); p += 4;
+	a201Hdl->stormHoldoff  = CFG_GET32( p ); p += 4;
+
+	/* slot arrays in A201_CFG_ARR_xxx order */
+	CFG_GETARR( a201Hdl, p, irqVector );
+	CFG_GETARR( a201Hdl, p, irqLevel );
+	CFG_GETARR( a201Hdl, p, irqPriority );
+	CFG_GETARR( a201Hdl, p, forceFound );
+	CFG_GETARR( a201Hdl, p, irqPendChk );
+	CFG_GETARR( a201Hdl, p, pollReq );
+	CFG_GETARR( a201Hdl, p, adaptive );
+
+	DBGWRT_2((DBH," %s DescCfgBlob: A201_CONFIG used\n", BBNAME));
+	return ERR_SUCCESS;
+}
+
+/********************************* CfgInfoSlot ******************************
+ *
+ *  Description:  Fulfils the BB_CfgInfo(BBIS_CFGINFO_SLOT) request
+ * 
+ *				  The variable-argument list (argptr) contains the following
+ *                parameters in the given order:
+ *
+ *                Input
+ *                -----
+ *                mSlot (u_int32) - device slot number  
+ *
+ *                Output
+ *                ------
+ *                occupied (u_int32*) - occupied information
+ *                 - pluggable device: 
+ *                   BBIS_SLOT_OCCUP_YES if slot is occupied
+ *                   or BBIS_SLOT_OCCUP_NO if slot is empty
+ *                 - onboard device: 
+ *                   BBIS_SLOT_OCCUP_ALW if device is enabled
+ *                   or BBIS_SLOT_OCCUP_DIS if device is disabled
+ *
+ *                devId (u_int32*) - device id (4-byte hex value)
+ *                  The device id should identify the type of the device
+ *                  but should not contain enough information to differentiate
+ *                  between two identical devices. If the device id is unknown
+ *                  BBIS_SLOT_NBR_UNK must be returned. 
+ *                  - M-Module:
+ *                    id-prom-magic-word << 16 | id-prom-module-id
+ *                    Example: 0x53460024
+ *                    Note: The returned device id must be identical to the
+ *                          "autoid" value in the device drivers xml file.  
+ *
+ *                devRev (u_int32*) - device revision (4-byte hex value)
+ *                  - M-Module: id-prom-layout-revision << 16 |
+ *                              id-prom-product-variant
+ *                              example: 0x01091400       
+ *                    or BBIS_SLOT_NBR_UNK if device revision is unknown
+ *
+ *                slotName (char*) - slot name
+ *                  The slot name should consist of the slot type and the
+ *                  slot label but must not contain any non-printing
+ *                  characters.
+ *                  The length of the returned string, including the
+ *                  terminating null character, must not exceed
+ *                  BBIS_SLOT_STR_MAXSIZE.
+ *                  format : "<slot type> <slot label>"
  *
  *                  Examples:
  *                  - M-Module:		"M-Module slot 0"
@@ -1617,10 +3148,8 @@ static int32 A201_Unused
  ****************************************************************************/
 static int32 CfgInfoSlot( BBIS_HANDLE *brdHdl, va_list argptr )	/* nodoc */
 {
-	int32	status, status2;
-	u_int32	modAddrSize;
-	void	*physModAddr, *virtModAddr;
-	u_int32 modType;
+	int32	status;
+	A201_SLOT_INFO *info;
 
     A201_BRD_STRUCT *a201Hdl = (A201_BRD_STRUCT*)brdHdl;
 
@@ -1659,52 +3188,86 @@ static int32 CfgInfoSlot( BBIS_HANDLE *brdHdl, va_list argptr )	/* nodoc */
 	/*------------------------------+
 	| get module information        |
 	+------------------------------*/
-	/* get physical module addr */
-	if( (status = A201_GetMAddr( brdHdl, mSlot, MDIS_MA08, MDIS_MD16,
-								 &physModAddr, &modAddrSize )) ){
+	/* let a running scan pass/prefetch fill the cache */
+	if( (status = PnpScanWait( a201Hdl, OSS_SEM_WAITFOREVER )) )
 		return status;
-	}
-	
+
+	/* probe slot if not cached (or only the presence is known) */
+	if( (!a201Hdl->pnpValid[mSlot] || !a201Hdl->pnpFull[mSlot]) &&
+		(status = PnpProbe( a201Hdl, mSlot, TRUE )) )
+		return status;
+
+	info = &a201Hdl->pnp[mSlot];
+	*occupied = info->occupied;
+	*devId    = info->devId;
+	*devRev   = info->devRev;
+	OSS_MemCopy( a201Hdl->osHdl, sizeof(info->devName), info->devName,
+				 devName );
+
+	/* return on success */ 
+	return ERR_SUCCESS;
+}
+
+/********************************* PnpProbe *********************************
+ *
+ *  Description:  Reads the ID-PROM of the M-Module in slot 'mSlot' and
+ *                stores the result in the slot inventory cache
+ *
+ *                The slot interface is set up for the read and cleared
+ *                afterwards, unless a device already uses the slot.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *				 full			read devRev/devName too (see PnpRead)
+ *  Output.....: return			error code
+ *  Globals....: -
+ ****************************************************************************/
+static int32 PnpProbe(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl,
+	u_int32 mSlot,
+	u_int32 full )
+{
+	int32	status, status2;
+	u_int32	modAddrSize = A201_M_A08_SIZE;
+	void	*virtModAddr;
+	void	*physModAddr = (void*)((u_int8*)a201Hdl->physAddr + 0x200 * mSlot);
+	int		inUse = a201Hdl->mifaceSet[mSlot];
+
+	a201Hdl->pnpValid[mSlot] = FALSE;
+
 	/* init module slot */
-	if( (status = A201_SetMIface( brdHdl, mSlot, MDIS_MA08, MDIS_MD16 )) ){
+	if( !inUse && (status = SlotIfaceSet( a201Hdl, mSlot )) )
 		return status;
-	}
 	
 	/*
 	 * map module address space
 	 * (quick and dirty without resource assignment)
 	 */ 
-	if( (status = OSS_MapPhysToVirtAddr( a201Hdl->osHdl, physModAddr, modAddrSize,
-										 OSS_ADDRSPACE_MEM, OSS_BUSTYPE_PCI,
-										 a201Hdl->busNbr, &virtModAddr )) ){
-		A201_ClrMIface( brdHdl, mSlot );
+	if( a201Hdl->virtBrdAddr )
+		virtModAddr = (void*)((u_int8*)a201Hdl->virtBrdAddr + 0x200 * mSlot);
+	else if( (status = OSS_MapPhysToVirtAddr( a201Hdl->osHdl, physModAddr,
+											  modAddrSize, OSS_ADDRSPACE_MEM,
+											  OSS_BUSTYPE_PCI, a201Hdl->busNbr,
+											  &virtModAddr )) ){
+		if( !inUse )
+			SlotIfaceClr( a201Hdl, mSlot );
 		return status;
 	}
+	else
+		PERF_ALLOC( a201Hdl );
 
 	/* now get the information */
-	m_getmodinfo( (U_INT32_OR_64)virtModAddr, &modType,
-				  devId, devRev, devName );
-
-	DBGWRT_2((DBH," modType=%d, devId=0x%08x, devRev=0x%08x, devName=%s\n",
-				  modType, *devId, *devRev, devName ));
-
-	/*
-	 * MEN M-Module detected?
-	 * Note: modType=MODCOM_MOD_THIRD (magic-id <> 0x5346) is not safe for the
-	 *       detection without a DTACK timeout interrupt. Therefore, we support
-	 *       here only MEN M-Modules (magic-id=0x5346).
-	 */
-	if( modType == MODCOM_MOD_MEN )
-		*occupied = BBIS_SLOT_OCCUP_YES;	
-	/* no MEN M-Module detected */
-	else
-		*occupied = BBIS_SLOT_OCCUP_NO;
+	PnpRead( a201Hdl, mSlot, virtModAddr, full );
 
 	/* unmap module address space */
-	status = OSS_UnMapVirtAddr(a201Hdl->osHdl, &virtModAddr,
-							   modAddrSize, OSS_ADDRSPACE_MEM);
+	if( a201Hdl->virtBrdAddr )
+		status = ERR_SUCCESS;
+	else
+		status = OSS_UnMapVirtAddr(a201Hdl->osHdl, &virtModAddr,
+								   modAddrSize, OSS_ADDRSPACE_MEM);
 	/* clear module slot */
-	status2 = A201_ClrMIface( brdHdl, mSlot );
+	status2 = inUse ? ERR_SUCCESS : SlotIfaceClr( a201Hdl, mSlot );
 
 	/* return on error */ 
 	if( status )
@@ -1712,10 +3275,1771 @@ static int32 CfgInfoSlot( BBIS_HANDLE *brdHdl, va_list argptr )	/* nodoc */
 	if( status2 )
 		return status2;
 
+	a201Hdl->pnpValid[mSlot] = TRUE;
+
 	/* return on success */ 
 	return ERR_SUCCESS;
 }
 
+/********************************* PnpScan **********************************
+ *
+ *  Description:  Probes all slots in 'slotMask' and waits for the result
+ *
+ *                See PnpScanStart: the slots are probed at the same time,
+ *                one task per slot.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 slotMask		slots to probe (bit n = slot n)
+ *  Output.....: return			error code
+ *  Globals....: -
+ ****************************************************************************/
+static int32 PnpScan( A201_BRD_STRUCT *a201Hdl, u_int32 slotMask )	/* nodoc */
+{
+	int32	status;
+
+	if( (status = PnpScanStart( a201Hdl, slotMask )) ||
+		(status = PnpScanWait( a201Hdl, OSS_SEM_WAITFOREVER )) )
+		return status;
+
+	return a201Hdl->scanStatus;
+}
+
+/******************************* PnpScanStart *******************************
+ *
+ *  Description:  Starts probing all slots in 'slotMask'
+ *
+ *                Every slot is probed by a task of its own (TaskStart,
+ *                PnpScanTask), so the pass takes about the time of one
+ *                ID-PROM read. A slot whose task cannot be started is
+ *                probed by the caller. The module windows of all slots
+ *                are reached through one mapping of the whole board (the
+ *                MAP_WHOLE_BOARD mapping or a temporary one). Slots with
+ *                PNP_FORCE_FOUND set are reported as occupied without
+ *                reading the ID-PROM.
+ *
+ *                Only one pass runs at a time, a second one waits for the
+ *                first. PnpScanWait waits for the end of the pass.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 slotMask		slots to probe (bit n = slot n)
+ *  Output.....: return			error code
+ *  Globals....: -
+ ****************************************************************************/
+static int32 PnpScanStart( A201_BRD_STRUCT *a201Hdl, u_int32 slotMask )	/* nodoc */
+{
+	int32	status;
+	void	*virtBrdAddr = a201Hdl->virtBrdAddr;
+	u_int32	mSlot;
+	A201_SLOT_INFO	*info;
+	A201_SCAN_JOB	*job;
+
+	DBGWRT_2((DBH," %s PnpScanStart: slotMask=0x%x\n", BBNAME, slotMask ));
+
+	if( (status = OSS_SemWait( a201Hdl->osHdl, a201Hdl->scanLock,
+							   OSS_SEM_WAITFOREVER )) )
+		return status;
+
+	/* drop the end signal of the last pass */
+	OSS_SemWait( a201Hdl->osHdl, a201Hdl->scanDone, 0 );
+
+	/* map the whole board for this pass */
+	if( !virtBrdAddr ){
+		if( (status = OSS_MapPhysToVirtAddr( a201Hdl->osHdl,
+											 a201Hdl->physAddr, A201_SIZE,
+											 OSS_ADDRSPACE_MEM,
+											 OSS_BUSTYPE_PCI,
+											 a201Hdl->busNbr,
+											 &virtBrdAddr )) ){
+			OSS_SemSignal( a201Hdl->osHdl, a201Hdl->scanLock );
+			return status;
+		}
+		PERF_ALLOC( a201Hdl );
+	}
+
+	a201Hdl->scanAddr   = virtBrdAddr;
+	a201Hdl->scanMask   = slotMask;
+	a201Hdl->scanStatus = ERR_SUCCESS;
+	a201Hdl->scanRun    = 1;		/* held until all tasks are started */
+	a201Hdl->scanActive = TRUE;
+	A201_MEM_BARRIER();
+
+	for( mSlot=0; mSlot<A201_NBR_OF_SLOTS; mSlot++ ){
+		if( !(slotMask & (1 << mSlot)) )
+			continue;
+
+		job = &a201Hdl->scanJob[mSlot];
+		job->status = ERR_SUCCESS;
+
+		if( a201Hdl->forceFound[mSlot] ){
+			info = &a201Hdl->pnp[mSlot];
+			info->occupied   = BBIS_SLOT_OCCUP_YES;
+			info->devId      = BBIS_SLOT_NBR_UNK;
+			info->devRev     = BBIS_SLOT_NBR_UNK;
+			info->devName[0] = '\0';
+			a201Hdl->pnpValid[mSlot] = TRUE;
+			a201Hdl->pnpFull[mSlot]  = TRUE;
+			continue;
+		}
+
+		job->a201Hdl = a201Hdl;
+		job->mSlot   = mSlot;
+
+		REG_LOCK( a201Hdl );
+		a201Hdl->scanRun++;
+		REG_UNLOCK( a201Hdl );
+
+		if( TaskStart( PnpScanTask, job ) ){
+			/* no task: probe it here */
+			REG_LOCK( a201Hdl );
+			a201Hdl->scanRun--;
+			REG_UNLOCK( a201Hdl );
+			job->status = PnpScanSlot( a201Hdl, mSlot, virtBrdAddr );
+		}
+	}
+
+	PnpScanEnd( a201Hdl );
+	return ERR_SUCCESS;
+}
+
+/******************************* PnpScanWait ********************************
+ *
+ *  Description:  Waits for the end of a PnpScanStart pass
+ *
+ *                Returns at once if no pass is running. The end signal
+ *                is passed on to other waiters.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 msec			timeout (ms), OSS_SEM_WAITFOREVER=endless
+ *  Output.....: return			error code
+ *  Globals....: -
+ ****************************************************************************/
+static int32 PnpScanWait( A201_BRD_STRUCT *a201Hdl, int32 msec )	/* nodoc */
+{
+	int32	status;
+
+	if( !a201Hdl->scanActive ){
+		A201_MEM_BARRIER();		/* pairs with PnpScanEnd */
+		return ERR_SUCCESS;
+	}
+
+	if( (status = OSS_SemWait( a201Hdl->osHdl, a201Hdl->scanDone, msec )) ){
+		DBGWRT_ERR((DBH," *** %s PnpScanWait: slot probe not done\n",
+					BBNAME));
+		return status;
+	}
+
+	OSS_SemSignal( a201Hdl->osHdl, a201Hdl->scanDone );
+	return ERR_SUCCESS;
+}
+
+/******************************* PnpScanTask ********************************
+ *
+ *  Description:  Probe task of one slot (PnpScanStart)
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: arg			slot job (A201_SCAN_JOB)
+ *  Output.....: -
+ *  Globals....: -
+ ****************************************************************************/
+static void PnpScanTask( void *arg )	/* nodoc */
+{
+	A201_SCAN_JOB	*job = (A201_SCAN_JOB*)arg;
+	A201_BRD_STRUCT	*a201Hdl = (A201_BRD_STRUCT*)job->a201Hdl;
+
+	job->status = PnpScanSlot( a201Hdl, job->mSlot, a201Hdl->scanAddr );
+	PnpScanEnd( a201Hdl );
+}
+
+/******************************** PnpScanEnd ********************************
+ *
+ *  Description:  Ends a slot of a PnpScanStart pass
+ *
+ *                The last one collects the result, releases the board
+ *                mapping of the pass and signals the end.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *  Output.....: -
+ *  Globals....: -
+ ****************************************************************************/
+static void PnpScanEnd( A201_BRD_STRUCT *a201Hdl )	/* nodoc */
+{
+	u_int32	mSlot, last;
+	int32	status = ERR_SUCCESS;
+
+	REG_LOCK( a201Hdl );
+	last = ( --a201Hdl->scanRun == 0 );
+	REG_UNLOCK( a201Hdl );
+
+	if( !last )
+		return;
+
+	for( mSlot=0; mSlot<A201_NBR_OF_SLOTS; mSlot++ )
+		if( (a201Hdl->scanMask & (1 << mSlot)) && !status )
+			status = a201Hdl->scanJob[mSlot].status;
+
+	/* unmap temporary board mapping */
+	if( !a201Hdl->virtBrdAddr ){
+		int32 status2 = OSS_UnMapVirtAddr( a201Hdl->osHdl,
+										   &a201Hdl->scanAddr,
+										   A201_SIZE, OSS_ADDRSPACE_MEM );
+		if( !status )
+			status = status2;
+	}
+	a201Hdl->scanAddr = NULL;
+
+	DBGWRT_2((DBH," %s PnpScanEnd: status=0x%x\n", BBNAME, status ));
+
+	a201Hdl->scanStatus = status;
+	A201_MEM_BARRIER();		/* results visible before the end */
+	a201Hdl->scanActive = FALSE;
+	OSS_SemSignal( a201Hdl->osHdl, a201Hdl->scanDone );
+	OSS_SemSignal( a201Hdl->osHdl, a201Hdl->scanLock );
+}
+
+/******************************** PnpScanSlot *******************************
+ *
+ *  Description:  Probes one slot of a PnpScanStart pass
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *				 virtBrdAddr	whole board mapping
+ *  Output.....: return			error code
+ *  Globals....: -
+ ****************************************************************************/
+static int32 PnpScanSlot(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl,
+	u_int32 mSlot,
+	void *virtBrdAddr )
+{
+	int32	status;
+	void	*virtModAddr = (u_int8*)virtBrdAddr + 0x200 * mSlot;
+
+	a201Hdl->pnpValid[mSlot] = FALSE;
+
+	if( a201Hdl->mifaceSet[mSlot] ){
+		/* slot used by a device: interface already set up */
+		PnpRead( a201Hdl, mSlot, virtModAddr, TRUE );
+	}
+	else {
+		if( (status = SlotIfaceSet( a201Hdl, mSlot )) )
+			return status;
+		PnpRead( a201Hdl, mSlot, virtModAddr, TRUE );
+		if( (status = SlotIfaceClr( a201Hdl, mSlot )) )
+			return status;
+	}
+
+	a201Hdl->pnpValid[mSlot] = TRUE;
+	return ERR_SUCCESS;
+}
+
+/******************************* PnpComplete ********************************
+ *
+ *  Description:  Probes all slots not in the inventory cache in one pass
+ *
+ *                A pass already running (A201_PNP_SCAN) is waited for.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *  Output.....: return			error code
+ *  Globals....: -
+ ****************************************************************************/
+static int32 PnpComplete( A201_BRD_STRUCT *a201Hdl )	/* nodoc */
+{
+	u_int32	missing = 0, i;
+	int32	status;
+
+	if( (status = PnpScanWait( a201Hdl, OSS_SEM_WAITFOREVER )) )
+		return status;
+
+	for( i=0; i<A201_NBR_OF_SLOTS; i++ )
+		if( !a201Hdl->pnpValid[i] || !a201Hdl->pnpFull[i] )
+			missing |= 1 << i;
+
+	if( missing )
+		return PnpScan( a201Hdl, missing );
+
+	return ERR_SUCCESS;
+}
+
+/********************************* TaskStart ********************************
+ *
+ *  Description:  Runs fkt(arg) in a task of its own
+ *
+ *                With A201_TASK_HOOK the environment starts the task
+ *                (A201_TaskStart), under Linux a kernel thread is
+ *                started. Other systems have no task here: the call
+ *                fails and the caller does the work itself.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: fkt			task routine
+ *				 arg			its argument
+ *  Output.....: return			error code
+ *  Globals....: -
+ ****************************************************************************/
+#if !defined(A201_TASK_HOOK) && defined(LINUX) && defined(__KERNEL__)
+typedef struct
+{
+	void	(*fkt)( void *arg );
+	void	*arg;
+} A201_TASK;
+
+static int TaskMain( void *data )	/* nodoc */
+{
+	A201_TASK	task = *(A201_TASK*)data;
+
+	kfree( data );
+	task.fkt( task.arg );
+	return 0;
+}
+#endif
+
+static int32 TaskStart( void (*fkt)( void *arg ), void *arg )	/* nodoc */
+{
+#if defined(A201_TASK_HOOK)
+	return A201_TaskStart( fkt, arg );
+#elif defined(LINUX) && defined(__KERNEL__)
+	A201_TASK			*task = kmalloc( sizeof(*task), GFP_KERNEL );
+	struct task_struct	*thread;
+
+	if( !task )
+		return ERR_OSS_MEM_ALLOC;
+
+	task->fkt = fkt;
+	task->arg = arg;
+	thread = kthread_run( TaskMain, task, "a201_task" );
+	if( IS_ERR( thread ) ){
+		kfree( task );
+		return ERR_OSS_MEM_ALLOC;
+	}
+	return ERR_SUCCESS;
+#else
+	(void)fkt;
+	(void)arg;
+	return ERR_BBIS_ILL_FUNC;
+#endif
+}
+
+/******************************** PnpPrefetch *******************************
+ *
+ *  Description:  Starts the ID-PROM prefetch
+ *
+ *                A PnP scan pass (PnpScanStart) reads all slots that are
+ *                not cached, not PNP_FORCE_FOUND and not used by a device.
+ *                Only if tasks can be started, otherwise the caller would
+ *                do the reads itself.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *  Output.....: return			error code
+ *  Globals....: -
+ ****************************************************************************/
+static int32 PnpPrefetch( A201_BRD_STRUCT *a201Hdl )	/* nodoc */
+{
+#ifdef A201_TASKS
+	u_int32	mSlot, mask = 0;
+
+	for( mSlot=0; mSlot<A201_NBR_OF_SLOTS; mSlot++ )
+		if( !a201Hdl->forceFound[mSlot] && !a201Hdl->mifaceSet[mSlot] &&
+			(!a201Hdl->pnpValid[mSlot] || !a201Hdl->pnpFull[mSlot]) )
+			mask |= 1 << mSlot;
+
+	if( !mask )
+		return ERR_SUCCESS;
+
+	return PnpScanStart( a201Hdl, mask );
+#else
+	(void)a201Hdl;
+	return ERR_SUCCESS;
+#endif
+}
+
+/********************************* PnpRead **********************************
+ *
+ *  Description:  Reads the ID-PROM of slot 'mSlot' into the inventory cache
+ *
+ *                Only the magic word and the module id are read first,
+ *                this decides the occupancy. The remaining fields
+ *                (m_getmodinfo) are read if 'full' is set. Without 'full',
+ *                a complete entry with the same module id is kept.
+ *
+ *                The slot interface must be set up.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *				 virtModAddr	mapped A08 module window
+ *				 full			read devRev/devName too
+ *  Output.....: -
+ *  Globals....: -
+ ****************************************************************************/
+static void PnpRead(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl,
+	u_int32 mSlot,
+	void *virtModAddr,
+	u_int32 full )
+{
+	u_int32 modType, devId;
+	A201_SLOT_INFO	*info = &a201Hdl->pnp[mSlot];
+
+	/*
+	 * MEN M-Module detected?
+	 * Note: modType=MODCOM_MOD_THIRD (magic-id <> 0x5346) is not safe for the
+	 *       detection without a DTACK timeout interrupt. Therefore, we support
+	 *       here only MEN M-Modules (magic-id=0x5346).
+	 */
+	if( m_read( (U_INT32_OR_64)virtModAddr, 0 ) != A201_IDPROM_MAGIC ){
+		/* no MEN M-Module detected */
+		info->occupied   = BBIS_SLOT_OCCUP_NO;
+		info->devId      = BBIS_SLOT_NBR_UNK;
+		info->devRev     = BBIS_SLOT_NBR_UNK;
+		info->devName[0] = '\0';
+		a201Hdl->pnpFull[mSlot] = TRUE;
+		DBGWRT_2((DBH," slot %d empty\n", mSlot ));
+		return;
+	}
+
+	/* same format as m_getmodinfo: magic-id in the upper half */
+	devId = ((u_int32)A201_IDPROM_MAGIC << 16) |
+			m_read( (U_INT32_OR_64)virtModAddr, 1 );
+
+	/* same module as before? */
+	if( !full && a201Hdl->pnpFull[mSlot] &&
+		info->occupied == BBIS_SLOT_OCCUP_YES && info->devId == devId )
+		return;
+
+	info->occupied = BBIS_SLOT_OCCUP_YES;
+	info->devId    = devId;
+
+	if( !full ){
+		info->devRev     = BBIS_SLOT_NBR_UNK;
+		info->devName[0] = '\0';
+		a201Hdl->pnpFull[mSlot] = FALSE;
+		DBGWRT_2((DBH," slot %d devId=0x%08x\n", mSlot, devId ));
+		return;
+	}
+
+	/* get the remaining information */
+	info->devName[0] = '\0';
+	m_getmodinfo( (U_INT32_OR_64)virtModAddr, &modType,
+				  &info->devId, &info->devRev, info->devName );
+	a201Hdl->pnpFull[mSlot] = TRUE;
+
+	DBGWRT_2((DBH," modType=%d, devId=0x%08x, devRev=0x%08x, devName=%s\n",
+				  modType, info->devId, info->devRev, info->devName ));
+
+	if( modType != MODCOM_MOD_MEN )
+		info->occupied = BBIS_SLOT_OCCUP_NO;
+}
+
+/******************************** SlotRegsWrite *****************************
+ *
+ *  Description:  Writes control and vector register of slot 'mSlot'
+ *
+ *                The last written values are kept in a shadow. A register
+ *                is only written if its shadow is invalid or differs from
+ *                the new value. Clear shadowValid[mSlot] to force both
+ *                writes.
+ *
+ *                When the interrupt gets enabled the vector is written
+ *                first, otherwise the control register is written first.
+ *                If both registers must be written and CTRL_ACCESS_D32 is
+ *                active, they are written with one D32 access.
+ *                If the slot is not mapped (MAP_LAZY), only the shadow
+ *                is updated.
+ *
+ *                The caller must hold REG_LOCK across computing the new
+ *                values and this call; otherwise the interrupt path or an
+ *                alarm may overwrite the decision with a stale one.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *				 control		control register value
+ *				 vector			vector register value
+ *  Output.....: -
+ *  Globals....: -
+ ****************************************************************************/
+static void SlotRegsWrite(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl,
+	u_int32 mSlot,
+	u_int16 control,
+	u_int16 vector )
+{
+	int		valid = a201Hdl->shadowValid[mSlot];
+	int		wrCtrl, wrVect;
+
+	/* not mapped (MAP_LAZY): written when the slot gets mapped */
+	if( !a201Hdl->virtModCtrlAddr[mSlot] ){
+		a201Hdl->ctrlShadow[mSlot]  = control;
+		a201Hdl->vectShadow[mSlot]  = vector;
+		a201Hdl->shadowValid[mSlot] = FALSE;
+		StatusUpdate( a201Hdl, mSlot );
+		return;
+	}
+
+	wrCtrl = !valid || a201Hdl->ctrlShadow[mSlot] != control;
+	wrVect = !valid || a201Hdl->vectShadow[mSlot] != vector;
+
+	if( a201Hdl->ctrlD32 && wrCtrl && wrVect ){
+		CTRL_WRITE_D32( a201Hdl, mSlot, A201_CTRL_OFFS,
+						A201_CTRL_VECT_D32( control, vector ) );
+		wrCtrl = wrVect = FALSE;
+	}
+
+	if( (control & A201_CTRL_IRQ_ENABLE) && wrVect ){
+		CTRL_WRITE_D16( a201Hdl, mSlot, A201_VECT_OFFS, vector );
+		wrVect = FALSE;
+	}
+
+	if( wrCtrl )
+		CTRL_WRITE_D16( a201Hdl, mSlot, A201_CTRL_OFFS, control );
+
+	if( wrVect )
+		CTRL_WRITE_D16( a201Hdl, mSlot, A201_VECT_OFFS, vector );
+
+	a201Hdl->ctrlShadow[mSlot]  = control;
+	a201Hdl->vectShadow[mSlot]  = vector;
+	a201Hdl->shadowValid[mSlot] = TRUE;
+
+	StatusUpdate( a201Hdl, mSlot );
+}
+
+/******************************* StatusUpdate *******************************
+ *
+ *  Description:  Copies the state of slot 'mSlot' to the status page
+ *
+ *                The sequence counter is odd while the entry is updated.
+ *                Readers of a mapped status page retry if the counter is
+ *                odd or changed while reading.
+ *                Task level, interrupt path and alarms all update the
+ *                page: must be called with REG_LOCK held, which makes
+ *                them a single writer.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *  Output.....: -
+ *  Globals....: -
+ ****************************************************************************/
+static void StatusUpdate(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl,
+	u_int32 mSlot )
+{
+	volatile A201_STATUS_PAGE	*page = a201Hdl->status;
+	volatile A201_STATUS_SLOT	*st = &page->slot[mSlot];
+
+	page->seq++;
+	A201_MEM_BARRIER();		/* odd count visible before the entry */
+	st->ctrl       = a201Hdl->ctrlShadow[mSlot];
+	st->vect       = a201Hdl->vectShadow[mSlot];
+	st->irqEnabled = a201Hdl->irqEnabled[mSlot];
+	st->pollMode   = a201Hdl->pollMode[mSlot];
+	st->stormHeld  = a201Hdl->stormHeld[mSlot];
+	st->mifaceSet  = a201Hdl->mifaceSet[mSlot];
+	A201_MEM_BARRIER();		/* entry visible before the even count */
+	page->seq++;
+}
+
+/********************************** MapOpen *********************************
+ *
+ *  Description:  Counts a user space mapping and returns its region
+ *
+ *                The status page is mapped read only.
+ *                The control registers are exported per slot
+ *                (A201_MAP_OFFS_CTRL_SLOT), read only: user space may watch
+ *                the irq pending bit, changes go through SetStat
+ *                (e.g. A201_IRQ_ENABLE_MASK), which checks them before
+ *                they are written.
+ *                A mapping covers whole pages. If the page holding a
+ *                slot's control registers reaches beyond them (into the
+ *                slot's own or another slot's A08 window), the mapping is
+ *                refused.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 offs			A201_MAP_OFFS_xxx
+ *  Output.....: reg			region to map
+ *				 return			error code
+ *  Globals....: -
+ ****************************************************************************/
+static int32 MapOpen(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl,
+	u_int32 offs,
+	A201_MAP_REGION *reg )
+{
+	U_INT32_OR_64	ctrl, page;
+	u_int32			mSlot;
+
+	if( offs == A201_MAP_OFFS_STATUS ){
+		reg->addr      = a201Hdl->status;
+		reg->size      = A201_STATUS_SIZE;
+		reg->addrSpace = OSS_ADDRSPACE_MEM;
+		reg->readOnly  = TRUE;
+		a201Hdl->statusMapCnt++;
+		return ERR_SUCCESS;
+	}
+
+	if( (mSlot = MapCtrlSlot( offs )) >= A201_NBR_OF_SLOTS )
+		return ERR_BBIS_ILL_PARAM;
+
+	/* the page must not reach beyond the slot's control registers */
+	ctrl = (U_INT32_OR_64)a201Hdl->physAddr + A201_CTRL_REG_1 + 0x200 * mSlot;
+	page = ctrl & ~(U_INT32_OR_64)(A201_PAGE_SIZE - 1);
+	if( page != ctrl || A201_PAGE_SIZE > 0x200 - A201_CTRL_REG_1 ){
+		DBGWRT_ERR((DBH," *** %s MapOpen: slot %d control registers not "
+					"isolated by page size 0x%x\n", BBNAME, mSlot,
+					A201_PAGE_SIZE ));
+		return ERR_BBIS_ILL_FUNC;
+	}
+
+	reg->addr      = (void*)ctrl;
+	reg->size      = A201_PAGE_SIZE;
+	reg->addrSpace = A201_ADDRSPACE;
+	reg->readOnly  = TRUE;
+	a201Hdl->ctrlMapCnt++;
+	return ERR_SUCCESS;
+}
+
+/********************************* MapClose *********************************
+ *
+ *  Description:  Counts a user space mapping that is gone
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 offs			A201_MAP_OFFS_xxx
+ *  Output.....: return			error code
+ *  Globals....: -
+ ****************************************************************************/
+static int32 MapClose( A201_BRD_STRUCT *a201Hdl, u_int32 offs )	/* nodoc */
+{
+	if( offs == A201_MAP_OFFS_STATUS ){
+		if( !a201Hdl->statusMapCnt )
+			return ERR_BBIS_ILL_PARAM;
+		a201Hdl->statusMapCnt--;
+		return ERR_SUCCESS;
+	}
+
+	if( MapCtrlSlot( offs ) >= A201_NBR_OF_SLOTS || !a201Hdl->ctrlMapCnt )
+		return ERR_BBIS_ILL_PARAM;
+
+	a201Hdl->ctrlMapCnt--;
+	return ERR_SUCCESS;
+}
+
+/******************************** MapCtrlSlot *******************************
+ *
+ *  Description:  Returns the slot of a control register mmap offset
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: offs			mmap offset
+ *  Output.....: return			slot, >= A201_NBR_OF_SLOTS if none
+ *  Globals....: -
+ ****************************************************************************/
+static u_int32 MapCtrlSlot( u_int32 offs )	/* nodoc */
+{
+	offs -= A201_MAP_OFFS_CTRL;		/* below: wraps out of range */
+	if( offs % A201_MAP_CTRL_STRIDE )
+		return A201_NBR_OF_SLOTS;
+
+	return offs / A201_MAP_CTRL_STRIDE;
+}
+
+/********************************* A08Claim *********************************
+ *
+ *  Description:  Counts a user space mapping of the A08 window of slot
+ *                'mSlot' and returns the window
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *				 owner			OS layer device handle
+ *  Output.....: reg			window region
+ *				 return			error code
+ *  Globals....: -
+ ****************************************************************************/
+static int32 A08Claim(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl,
+	u_int32 mSlot,
+	void *owner,
+	A201_MAP_REGION *reg )
+{
+	if( !a201Hdl->mifaceSet[mSlot] ){
+		DBGWRT_ERR((DBH," *** %s A08Claim: slot %d interface not set up\n",
+					BBNAME, mSlot) );
+		return ERR_BBIS_ILL_PARAM;
+	}
+	if( owner == NULL || (a201Hdl->a08MapCnt[mSlot] &&
+						  a201Hdl->a08Owner[mSlot] != owner) ){
+		DBGWRT_ERR((DBH," *** %s A08Claim: A08 window of slot %d owned "
+					"by %p\n", BBNAME, mSlot, a201Hdl->a08Owner[mSlot]) );
+		return ERR_BBIS_ILL_PARAM;
+	}
+
+	reg->addr      = (void*)( (u_int8*)a201Hdl->physAddr + (0x200 * mSlot) );
+	reg->size      = A201_M_A08_SIZE;
+	reg->addrSpace = A201_ADDRSPACE;
+	reg->readOnly  = FALSE;
+
+	a201Hdl->a08Owner[mSlot] = owner;
+	a201Hdl->a08MapCnt[mSlot]++;
+	return ERR_SUCCESS;
+}
+
+/******************************** A08Release ********************************
+ *
+ *  Description:  Counts a user space mapping of the A08 window of slot
+ *                'mSlot' that is gone
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *				 owner			OS layer device handle (as claimed)
+ *  Output.....: return			error code
+ *  Globals....: -
+ ****************************************************************************/
+static int32 A08Release(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl,
+	u_int32 mSlot,
+	void *owner )
+{
+	if( a201Hdl->a08MapCnt[mSlot] == 0 || a201Hdl->a08Owner[mSlot] != owner )
+		return ERR_BBIS_ILL_PARAM;
+
+	if( --a201Hdl->a08MapCnt[mSlot] == 0 )
+		a201Hdl->a08Owner[mSlot] = NULL;
+	return ERR_SUCCESS;
+}
+
+/******************************* SlotIrqEnable ******************************
+ *
+ *  Description:  En/disables the interrupt of slot 'mSlot'
+ *
+ *                Maps the slot if needed (MAP_LAZY) and calls SlotIrqSet.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *				 enable			interrupt setting
+ *  Output.....: return			error code
+ *  Globals....: -
+ ****************************************************************************/
+static int32 SlotIrqEnable(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl,
+	u_int32 mSlot,
+	u_int32 enable )
+{
+	int32	error;
+
+	if( (error = SlotMap( a201Hdl, mSlot )) )
+		return error;
+
+	REG_LOCK( a201Hdl );
+	SlotIrqSet( a201Hdl, mSlot, enable );
+	REG_UNLOCK( a201Hdl );
+	return ERR_SUCCESS;
+}
+
+/******************************** SlotIrqSet ********************************
+ *
+ *  Description:  Records the driver's irq setting of slot 'mSlot' and
+ *                writes the control/vector register
+ *
+ *                Common part of A201_IrqEnable and A201_IRQ_ENABLE_MASK.
+ *                Register writes are skipped if the value is already
+ *                on the hardware (see SlotRegsWrite).
+ *                Must be called with REG_LOCK held.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *				 enable			interrupt setting
+ *  Output.....: -
+ *  Globals....: -
+ ****************************************************************************/
+static void SlotIrqSet(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl,
+	u_int32 mSlot,
+	u_int32 enable )
+{
+	u_int16	control = a201Hdl->irqLevel[mSlot];
+
+	/* a slot in storm holdoff is enabled when the holdoff expires */
+	if( enable && !IRQ_MASKED( a201Hdl, mSlot ) )
+		control |= A201_CTRL_IRQ_ENABLE;
+
+	/* count enable/disable toggles */
+	if( (enable ? 1 : 0) != a201Hdl->irqEnabled[mSlot] ){
+		if( enable ){
+			a201Hdl->irqStats[mSlot].enables++;
+#ifdef A201_HRTIME
+			a201Hdl->enaStamp[mSlot]   = HR_STAMP();
+			a201Hdl->enaPending[mSlot] = TRUE;
+#endif
+		}
+		else
+			a201Hdl->irqStats[mSlot].disables++;
+		a201Hdl->irqEnabled[mSlot] = enable ? 1 : 0;
+	}
+
+	SlotRegsWrite( a201Hdl, mSlot, control, a201Hdl->irqVector[mSlot] );
+}
+
+/******************************* SlotIfaceSet *******************************
+ *
+ *  Description:  Sets up the interface of slot 'mSlot'
+ *
+ *                Maps the control registers if needed (MAP_LAZY) and
+ *                writes the defaults (irq disabled, default vector).
+ *                Common part of A201_SetMIface and the slot probes.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *  Output.....: return			error code
+ *  Globals....: -
+ ****************************************************************************/
+static int32 SlotIfaceSet( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot )	/* nodoc */
+{
+	int32	error;
+
+	if( (error = SlotMap( a201Hdl, mSlot )) )
+		return error;
+
+	/* disable interrupts / default vector (resync shadow registers) */
+	REG_LOCK( a201Hdl );
+	a201Hdl->shadowValid[mSlot] = FALSE;
+	a201Hdl->mifaceSet[mSlot] = TRUE;
+	SlotRegsWrite( a201Hdl, mSlot, A201_CTRL_DEFAULT, A201_VECT_DEFAULT );
+	REG_UNLOCK( a201Hdl );
+	return ERR_SUCCESS;
+}
+
+/******************************* SlotIfaceClr *******************************
+ *
+ *  Description:  Cleans up the interface of slot 'mSlot'
+ *
+ *                Writes the defaults (irq disabled, default vector) and
+ *                unmaps the control registers (MAP_LAZY).
+ *                A08 window claims left by the OS layer are dropped, so
+ *                the next user of the slot can claim the window.
+ *                Common part of A201_ClrMIface and the slot probes.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *  Output.....: return			error code
+ *  Globals....: -
+ ****************************************************************************/
+static int32 SlotIfaceClr( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot )	/* nodoc */
+{
+	if( a201Hdl->a08MapCnt[mSlot] ){
+		DBGWRT_ERR((DBH," *** %s SlotIfaceClr: A08 window of slot %d still "
+					"mapped %d times by %p, released\n", BBNAME, mSlot,
+					a201Hdl->a08MapCnt[mSlot], a201Hdl->a08Owner[mSlot]) );
+		a201Hdl->a08MapCnt[mSlot] = 0;
+		a201Hdl->a08Owner[mSlot]  = NULL;
+	}
+
+	/* disable interrupts / default vector (resync shadow registers) */
+	REG_LOCK( a201Hdl );
+	a201Hdl->shadowValid[mSlot] = FALSE;
+	a201Hdl->mifaceSet[mSlot] = FALSE;
+	SlotRegsWrite( a201Hdl, mSlot, A201_CTRL_DEFAULT, A201_VECT_DEFAULT );
+	REG_UNLOCK( a201Hdl );
+	SlotUnmap( a201Hdl, mSlot );
+	return ERR_SUCCESS;
+}
+
+/********************************** SlotMap *********************************
+ *
+ *  Description:  Maps the control registers of slot 'mSlot' (MAP_LAZY)
+ *
+ *                Does nothing if the slot is already mapped or MAP_LAZY
+ *                is not set. The shadow is invalidated, so the next
+ *                SlotRegsWrite writes both registers.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *  Output.....: return			error code
+ *  Globals....: -
+ ****************************************************************************/
+static int32 SlotMap( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot )	/* nodoc */
+{
+	int32	error;
+
+	if( !a201Hdl->mapLazy || a201Hdl->virtModCtrlAddr[mSlot] )
+		return ERR_SUCCESS;
+
+	if( (error = OSS_MapPhysToVirtAddr( a201Hdl->osHdl,
+			(void*)((u_int8*)a201Hdl->physAddr + A201_CTRL_REG_1 +
+					mSlot * 0x200),
+			A201_CTRL_REG_SIZE, A201_ADDRSPACE, A201_BUSTYPE,
+			a201Hdl->busNbr, &a201Hdl->virtModCtrlAddr[mSlot] )) ){
+		DBGWRT_ERR((DBH," *** %s SlotMap: OSS_MapPhysToVirtAddr() failed\n",
+					BBNAME) );
+		a201Hdl->virtModCtrlAddr[mSlot] = NULL;
+		return error;
+	}
+
+	DBGWRT_2((DBH," %s SlotMap: slot %d mapped to 0x%08x\n", BBNAME, mSlot,
+			  a201Hdl->virtModCtrlAddr[mSlot] ));
+	PERF_ALLOC( a201Hdl );
+	a201Hdl->shadowValid[mSlot] = FALSE;
+	return ERR_SUCCESS;
+}
+
+/********************************* SlotUnmap ********************************
+ *
+ *  Description:  Unmaps the control registers of slot 'mSlot' (MAP_LAZY)
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *  Output.....: -
+ *  Globals....: -
+ ****************************************************************************/
+static void SlotUnmap( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot )	/* nodoc */
+{
+	void	*addr = a201Hdl->virtModCtrlAddr[mSlot];
+
+	if( !a201Hdl->mapLazy || !addr )
+		return;
+
+	/* interrupt path and alarms must no longer see the mapping */
+	REG_LOCK( a201Hdl );
+	a201Hdl->virtModCtrlAddr[mSlot] = NULL;
+	a201Hdl->shadowValid[mSlot] = FALSE;
+	REG_UNLOCK( a201Hdl );
+	OSS_UnMapVirtAddr( a201Hdl->osHdl, &addr, A201_CTRL_REG_SIZE,
+					   A201_ADDRSPACE );
+}
+
+/********************************* CtrlRead *********************************
+ *
+ *  Description:  Reads the control register of slot 'mSlot' from the
+ *                interrupt path or an alarm
+ *
+ *                The mapped address is loaded once. With MAP_LAZY, the
+ *                address is loaded and read under REG_LOCK: SlotUnmap
+ *                clears it under the lock before the unmap, so a read
+ *                never hits an unmapped address.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *  Output.....: ctrlP			control register
+ *				 return			TRUE if read, FALSE if slot unmapped
+ *  Globals....: -
+ ****************************************************************************/
+static int32 CtrlRead(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl,
+	u_int32 mSlot,
+	u_int16 *ctrlP )
+{
+	void	*addr;
+
+	/* mapped for the lifetime of the handle */
+	if( !a201Hdl->mapLazy ){
+		addr = a201Hdl->virtModCtrlAddr[mSlot];
+		if( !addr )
+			return FALSE;
+		*ctrlP = CTRL_READ_D16_AT( a201Hdl, addr, A201_CTRL_OFFS );
+		return TRUE;
+	}
+
+	REG_LOCK( a201Hdl );
+	addr = a201Hdl->virtModCtrlAddr[mSlot];
+	if( addr )
+		*ctrlP = CTRL_READ_D16_AT( a201Hdl, addr, A201_CTRL_OFFS );
+	REG_UNLOCK( a201Hdl );
+
+	return addr != NULL;
+}
+
+/******************************* VectTblBuild *******************************
+ *
+ *  Description:  Builds the vector to slot mask table from irqVector[]
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *  Output.....: -
+ *  Globals....: -
+ ****************************************************************************/
+static void VectTblBuild(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl )
+{
+	u_int32 i;
+
+	OSS_MemFill( a201Hdl->osHdl, sizeof(a201Hdl->vectSlots),
+				 (char*)a201Hdl->vectSlots, 0 );
+
+	for( i=0; i<A201_NBR_OF_SLOTS; i++ )
+		a201Hdl->vectSlots[a201Hdl->irqVector[i]] |= (u_int8)(1 << i);
+}
+
+/****************************** PrioOrderBuild ******************************
+ *
+ *  Description:  Sorts the slots by irqPriority (highest first)
+ *
+ *                The order is built in a local copy and published with
+ *                one store, so the poll alarm reads it without the lock. Callers after A201_Init hold REG_LOCK.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *  Output.....: -
+ *  Globals....: -
+ ****************************************************************************/
+static void PrioOrderBuild(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl )
+{
+	u_int32 i, j, order = 0;
+	u_int8	slot[A201_NBR_OF_SLOTS], tmp;
+
+	for( i=0; i<A201_NBR_OF_SLOTS; i++ )
+		slot[i] = (u_int8)i;
+
+	/* insertion sort, stable for equal priorities */
+	for( i=1; i<A201_NBR_OF_SLOTS; i++ ){
+		tmp = slot[i];
+		for( j=i; j>0 && a201Hdl->irqPriority[slot[j-1]] <
+				 a201Hdl->irqPriority[tmp]; j-- )
+			slot[j] = slot[j-1];
+		slot[j] = tmp;
+	}
+
+	for( i=0; i<A201_NBR_OF_SLOTS; i++ )
+		order |= (u_int32)slot[i] << (8 * i);
+
+	a201Hdl->prioOrder = order;
+}
+
+/******************************* IrqReprogram *******************************
+ *
+ *  Description:  Changes irq vector or level of slot 'mSlot' at runtime
+ *
+ *                Also allowed while the device is open. Under REG_LOCK,
+ *                the slot interrupt is disabled, the new vector/level is
+ *                written and the interrupt enabled again if the driver
+ *                has it enabled and the slot is neither in storm holdoff
+ *                nor polled. The interrupt path therefore never sees a
+ *                half updated slot or vector table. If the slot interface
+ *                is not set up, only the values are stored; A201_SetMIface/
+ *                A201_IrqEnable write them.
+ *
+ *                Note: The OS interrupt connection of the device is not
+ *                changed. The caller is responsible for connecting the
+ *                device's interrupt handler to the new vector/level.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *				 code			M_BB_IRQ_VECT | M_BB_IRQ_LEVEL
+ *				 value			new vector 0..255 | level 0..7
+ *  Output.....: return			error code
+ *  Globals....: -
+ ****************************************************************************/
+static int32 IrqReprogram(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl,
+	u_int32 mSlot,
+	int32 code,
+	int32 value )
+{
+	u_int8	slotBit = (u_int8)(1 << mSlot);
+	u_int16	control;
+
+	if( value < 0 ||
+		value > (code == M_BB_IRQ_VECT ? 0xff : A201_CTRL_IRQ_LEVEL) )
+		return ERR_BBIS_ILL_PARAM;
+
+	REG_LOCK( a201Hdl );
+
+	/* slot in use: no interrupt while vector and level change */
+	if( a201Hdl->mifaceSet[mSlot] )
+		SlotRegsWrite( a201Hdl, mSlot, a201Hdl->irqLevel[mSlot],
+					   a201Hdl->irqVector[mSlot] );
+
+	if( code == M_BB_IRQ_VECT ){
+		a201Hdl->vectSlots[a201Hdl->irqVector[mSlot]] &= (u_int8)~slotBit;
+		a201Hdl->irqVector[mSlot] = (u_int8)value;
+		a201Hdl->vectSlots[value] |= slotBit;
+	}
+	else
+		a201Hdl->irqLevel[mSlot]  = (u_int8)value;
+
+	if( a201Hdl->mifaceSet[mSlot] ){
+		control = a201Hdl->irqLevel[mSlot];
+		if( a201Hdl->irqEnabled[mSlot] && !IRQ_MASKED( a201Hdl, mSlot ) )
+			control |= A201_CTRL_IRQ_ENABLE;
+		SlotRegsWrite( a201Hdl, mSlot, control, a201Hdl->irqVector[mSlot] );
+	}
+	REG_UNLOCK( a201Hdl );
+
+	DBGWRT_2((DBH," %s IrqReprogram: slot=%d vector=0x%x level=%d\n", BBNAME,
+			  mSlot, a201Hdl->irqVector[mSlot], a201Hdl->irqLevel[mSlot] ));
+
+	return ERR_SUCCESS;
+}
+
+/******************************** StormCheck ********************************
+ *
+ *  Description:  Masks slot 'mSlot' if it exceeds the interrupt rate limit
+ *
+ *                Called from A201_IrqSrvInit. If more than IRQ_STORM_LIMIT
+ *                interrupts occur within IRQ_STORM_WINDOW, the irq enable
+ *                bit of the slot is cleared and the holdoff alarm started.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *  Output.....: -
+ *  Globals....: -
+ ****************************************************************************/
+static void StormCheck( A201_BRD_STRUCT *a201Hdl, u_int32 mSlot )	/* nodoc */
+{
+	u_int32	now = a201Hdl->srvStamp[mSlot];
+	u_int32	realMsec;
+
+	/* new window? */
+	if( now - a201Hdl->stormStart[mSlot] >= a201Hdl->stormWinTicks ){
+		a201Hdl->stormStart[mSlot] = now;
+		a201Hdl->stormCnt[mSlot]   = 0;
+	}
+
+	if( ++a201Hdl->stormCnt[mSlot] <= a201Hdl->stormLimit ||
+		a201Hdl->stormHeld[mSlot] )
+		return;
+
+	/* mask slot and start holdoff */
+	REG_LOCK( a201Hdl );
+	a201Hdl->stormHeld[mSlot] = TRUE;
+	a201Hdl->irqStats[mSlot].storms++;
+	SlotRegsWrite( a201Hdl, mSlot, a201Hdl->irqLevel[mSlot],
+				   a201Hdl->irqVector[mSlot] );
+	REG_UNLOCK( a201Hdl );
+	IRQ_TRACE( a201Hdl, mSlot, A201_TRC_STORM, 0 );
+
+	OSS_AlarmSet( a201Hdl->osHdl, a201Hdl->stormAlm[mSlot].alarmHdl,
+				  a201Hdl->stormHoldoff, FALSE, &realMsec );
+}
+
+/******************************** StormAlarm ********************************
+ *
+ *  Description:  End of storm holdoff: re-enables the slot interrupt
+ *
+ *                The interrupt is only enabled again if the device driver
+ *                has it enabled.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: arg			A201_SLOT_ALARM of the slot
+ *  Output.....: -
+ *  Globals....: -
+ ****************************************************************************/
+static void StormAlarm( void *arg )	/* nodoc */
+{
+	A201_SLOT_ALARM	*alm = (A201_SLOT_ALARM*)arg;
+	A201_BRD_STRUCT	*a201Hdl = (A201_BRD_STRUCT*)alm->brdHdl;
+	u_int32			mSlot = alm->mSlot;
+	u_int16			control;
+	u_int32			perfSave;
+
+	PERF_ENTER( a201Hdl, A201_PERF_ALARM, perfSave );
+	REG_LOCK( a201Hdl );
+	a201Hdl->stormHeld[mSlot] = FALSE;
+	a201Hdl->stormCnt[mSlot]  = 0;
+
+	control = a201Hdl->irqLevel[mSlot];
+	if( a201Hdl->irqEnabled[mSlot] && !a201Hdl->pollMode[mSlot] )
+		control |= A201_CTRL_IRQ_ENABLE;
+
+	SlotRegsWrite( a201Hdl, mSlot, control, a201Hdl->irqVector[mSlot] );
+	REG_UNLOCK( a201Hdl );
+	PERF_LEAVE( a201Hdl, perfSave );
+}
+
+/******************************** PollModeSet *******************************
+ *
+ *  Description:  Switches slot 'mSlot' between interrupt and polled mode
+ *
+ *                Switches the slot (PollModeSwitch), then starts or stops
+ *                the poll alarm (PollUpdate). Task level only.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *				 poll			0=interrupt driven, 1=polled
+ *  Output.....: return			error code
+ *  Globals....: -
+ ****************************************************************************/
+static int32 PollModeSet(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl,
+	u_int32 mSlot,
+	u_int32 poll )
+{
+	if( poll > 1 )
+		return ERR_BBIS_ILL_PARAM;
+
+	if( poll == a201Hdl->pollMode[mSlot] )
+		return ERR_SUCCESS;
+
+	PollModeSwitch( a201Hdl, mSlot, poll );
+	return PollUpdate( a201Hdl );
+}
+
+/****************************** PollModeSwitch ******************************
+ *
+ *  Description:  Sets the mode of slot 'mSlot' without touching the alarm
+ *
+ *                In polled mode the irq enable bit of the slot stays
+ *                cleared, A201_IrqEnable only records the driver's setting.
+ *                Switching back restores the driver's setting.
+ *                Safe in the poll alarm (AdaptCheck).
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *				 poll			0=interrupt driven, 1=polled
+ *  Output.....: -
+ *  Globals....: -
+ ****************************************************************************/
+static void PollModeSwitch(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl,
+	u_int32 mSlot,
+	u_int32 poll )
+{
+	u_int16	control;
+
+	DBGWRT_2((DBH," %s PollModeSwitch: slot=%d poll=%d\n", BBNAME,
+			  mSlot, poll));
+
+	REG_LOCK( a201Hdl );
+	a201Hdl->pollMode[mSlot] = (u_int8)poll;
+	if( poll )
+		a201Hdl->pollStart[mSlot] = A201_TIMESTAMP( a201Hdl );
+
+	if( a201Hdl->mifaceSet[mSlot] ){
+		control = a201Hdl->irqLevel[mSlot];
+		if( a201Hdl->irqEnabled[mSlot] && !IRQ_MASKED( a201Hdl, mSlot ) )
+			control |= A201_CTRL_IRQ_ENABLE;
+		SlotRegsWrite( a201Hdl, mSlot, control, a201Hdl->irqVector[mSlot] );
+	}
+	else
+		StatusUpdate( a201Hdl, mSlot );
+	REG_UNLOCK( a201Hdl );
+}
+
+/******************************** PollUpdate ********************************
+ *
+ *  Description:  Starts or stops the cyclic poll alarm
+ *
+ *                The alarm runs while at least one slot is in polled or
+ *                adaptive mode and has a poll signal.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *  Output.....: return			error code
+ *  Globals....: -
+ ****************************************************************************/
+static int32 PollUpdate( A201_BRD_STRUCT *a201Hdl )	/* nodoc */
+{
+	u_int32	i, need = FALSE, realMsec;
+	int32	error;
+
+	for( i=0; i<A201_NBR_OF_SLOTS; i++ )
+		if( (a201Hdl->pollMode[i] || a201Hdl->adaptive[i]) &&
+			a201Hdl->pollSig[i] )
+			need = TRUE;
+
+	if( need == a201Hdl->pollRunning )
+		return ERR_SUCCESS;
+
+	if( !need ){
+		a201Hdl->pollRunning = FALSE;
+		return OSS_AlarmClear( a201Hdl->osHdl, a201Hdl->pollAlm );
+	}
+
+	a201Hdl->pollLast   = A201_TIMESTAMP( a201Hdl );
+	a201Hdl->adaptStart = a201Hdl->pollLast;
+	if( (error = OSS_AlarmSet( a201Hdl->osHdl, a201Hdl->pollAlm,
+							   a201Hdl->pollPeriod, TRUE, &realMsec )) )
+		return error;
+
+	/* granted period in ticks, at least one tick */
+	a201Hdl->pollTicks = realMsec * OSS_TickRateGet( a201Hdl->osHdl ) / 1000;
+	if( a201Hdl->pollTicks == 0 )
+		a201Hdl->pollTicks = 1;
+
+	for( i=0; i<A201_NBR_OF_SLOTS; i++ )
+		a201Hdl->pollStats[i].period = realMsec;
+
+	a201Hdl->pollRunning = TRUE;
+	DBGWRT_2((DBH," %s PollUpdate: poll period %dms\n", BBNAME, realMsec));
+	return ERR_SUCCESS;
+}
+
+/********************************* PollSigSet *******************************
+ *
+ *  Description:  Installs or removes the poll signal of slot 'mSlot'
+ *
+ *                The signal is sent to the calling process by each poll
+ *                that finds the slot's irq pending.
+ *                Installing requires the slot interface to be set up. If
+ *                the slot requested polled mode (IRQ_POLL), it is switched
+ *                to polled mode now.
+ *                Removing switches the slot back to interrupt driven mode
+ *                and waits until a running PollAlarm has finished, so the
+ *                signal is never sent after this function returned.
+ *                Must be called from task level.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *				 signal			signal number or 0 (remove)
+ *  Output.....: return			error code
+ *  Globals....: -
+ ****************************************************************************/
+static int32 PollSigSet(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl,
+	u_int32 mSlot,
+	int32 signal )
+{
+	OSS_SIG_HANDLE	*sig = a201Hdl->pollSig[mSlot];
+	int32			error;
+
+	if( signal < 0 || (signal && !a201Hdl->mifaceSet[mSlot]) ){
+		DBGWRT_ERR((DBH," *** %s PollSigSet: slot %d illegal signal %d or "
+					"interface not set up\n", BBNAME, mSlot, signal ));
+		return ERR_BBIS_ILL_PARAM;
+	}
+
+	/*
+	 * remove the old signal, wait for a running poll (its AdaptCheck
+	 * may still switch the slot), then go back to interrupt mode
+	 */
+	if( sig ){
+		a201Hdl->pollSig[mSlot]    = NULL;
+		a201Hdl->pollSigNbr[mSlot] = 0;
+		PollIdleWait( a201Hdl );
+		OSS_SigRemove( a201Hdl->osHdl, &sig );
+		PollModeSet( a201Hdl, mSlot, 0 );
+		PollUpdate( a201Hdl );
+	}
+
+	if( !signal )
+		return ERR_SUCCESS;
+
+	/* the OSS sends the signal to the calling process */
+	if( (error = OSS_SigCreate( a201Hdl->osHdl, signal, &sig )) )
+		return error;
+
+	A201_MEM_BARRIER();		/* created before visible to PollAlarm */
+	a201Hdl->pollSig[mSlot]    = sig;
+	a201Hdl->pollSigNbr[mSlot] = signal;
+
+	if( a201Hdl->pollReq[mSlot] && !a201Hdl->adaptive[mSlot] &&
+		(error = PollModeSet( a201Hdl, mSlot, 1 )) )
+		return error;
+
+	return PollUpdate( a201Hdl );
+}
+
+/******************************** PollIdleWait ******************************
+ *
+ *  Description:  Waits until a running PollAlarm has finished
+ *
+ *                Blocks on the pollIdle semaphore, which PollAlarm
+ *                signals once per waiter when it ends.
+ *                Must be called from task level.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *  Output.....: -
+ *  Globals....: -
+ ****************************************************************************/
+static void PollIdleWait( A201_BRD_STRUCT *a201Hdl )	/* nodoc */
+{
+	u_int32	busy;
+
+	/* pairs with PollAlarm: it sees the change or we see it busy */
+	REG_LOCK( a201Hdl );
+	if( (busy = a201Hdl->pollBusy) )
+		a201Hdl->pollWaiters++;
+	REG_UNLOCK( a201Hdl );
+
+	if( busy )
+		OSS_SemWait( a201Hdl->osHdl, a201Hdl->pollIdle, OSS_SEM_WAITFOREVER );
+}
+
+/********************************* PollSlot *********************************
+ *
+ *  Description:  Polls slot 'mSlot'
+ *
+ *                Reads the irq pending bit of a polled slot and calls the
+ *                slot's poll signal if it is set.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *				 late			poll is late (count overrun)
+ *  Output.....: return			TRUE if the signal was sent
+ *  Globals....: -
+ ****************************************************************************/
+static int32 PollSlot(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl,
+	u_int32 mSlot,
+	u_int32 late )
+{
+	OSS_SIG_HANDLE	*sig = a201Hdl->pollSig[mSlot];
+	int		polled = a201Hdl->pollMode[mSlot] && sig;
+	u_int16	ctrl;
+
+	if( !polled || !CtrlRead( a201Hdl, mSlot, &ctrl ) )
+		return FALSE;
+
+	a201Hdl->pollStats[mSlot].polls++;
+	if( late )
+		a201Hdl->pollStats[mSlot].overruns++;
+
+	if( !(ctrl & A201_CTRL_IRQ_PENDING) )
+		return FALSE;
+
+	a201Hdl->pollStats[mSlot].hits++;
+	OSS_SigSend( a201Hdl->osHdl, sig );
+	return TRUE;
+}
+
+/********************************* PollAlarm ********************************
+ *
+ *  Description:  Cyclic poll of all slots in polled mode
+ *
+ *                Polls each slot (PollSlot). A poll that starts more than
+ *                one period late, or while the previous poll is still
+ *                running, counts as overrun.
+ *                With IRQ_PRIO_DISPATCH, the slots are polled in priority
+ *                order, and after each service the slots with higher
+ *                priority are polled again (at most prioDispatch times in
+ *                a row), so they never wait behind lower priority slots.
+ *                Once per adaptive window, AdaptCheck switches the mode of
+ *                adaptive slots.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: arg			board handle
+ *  Output.....: -
+ *  Globals....: -
+ ****************************************************************************/
+static void PollAlarm( void *arg )	/* nodoc */
+{
+	A201_BRD_STRUCT	*a201Hdl = (A201_BRD_STRUCT*)arg;
+	u_int32			now = A201_TIMESTAMP( a201Hdl );
+	u_int32			order = a201Hdl->prioOrder;
+	u_int32			late, i, s, h, n, hit, waiters, perfSave;
+
+	late = ( now - a201Hdl->pollLast > 2 * a201Hdl->pollTicks );
+	a201Hdl->pollLast = now;
+
+	if( a201Hdl->pollBusy ){
+		for( i=0; i<A201_NBR_OF_SLOTS; i++ )
+			if( a201Hdl->pollMode[i] )
+				a201Hdl->pollStats[i].overruns++;
+		return;
+	}
+	PERF_ENTER( a201Hdl, A201_PERF_ALARM, perfSave );
+	REG_LOCK( a201Hdl );	/* pairs with PollIdleWait */
+	a201Hdl->pollBusy = TRUE;
+	REG_UNLOCK( a201Hdl );
+
+	for( i=0; i<A201_NBR_OF_SLOTS; i++ ){
+		if( !a201Hdl->prioDispatch ){
+			PollSlot( a201Hdl, i, late );
+			continue;
+		}
+
+		s = PRIO_SLOT( order, i );
+		if( !PollSlot( a201Hdl, s, late ) )
+			continue;
+
+		/* serviced: higher priority slots again */
+		for( n=0, hit=TRUE; hit && n<a201Hdl->prioDispatch; n++ ){
+			hit = FALSE;
+			for( h=0; h<i; h++ ){
+				if( a201Hdl->irqPriority[PRIO_SLOT( order, h )] <=
+					a201Hdl->irqPriority[s] )
+					break;
+				if( PollSlot( a201Hdl, PRIO_SLOT( order, h ), FALSE ) )
+					hit = TRUE;
+			}
+		}
+	}
+
+	if( now - a201Hdl->adaptStart >= a201Hdl->adaptWinTicks ){
+		AdaptCheck( a201Hdl );
+		a201Hdl->adaptStart = now;
+	}
+
+	REG_LOCK( a201Hdl );
+	a201Hdl->pollBusy = FALSE;
+	waiters = a201Hdl->pollWaiters;
+	a201Hdl->pollWaiters = 0;
+	REG_UNLOCK( a201Hdl );
+
+	while( waiters-- )
+		OSS_SemSignal( a201Hdl->osHdl, a201Hdl->pollIdle );
+	PERF_LEAVE( a201Hdl, perfSave );
+}
+
+/******************************** AdaptCheck ********************************
+ *
+ *  Description:  Switches adaptive slots between interrupt and polled mode
+ *
+ *                Called from PollAlarm once per adaptive window.
+ *                The alarm keeps running while a slot is adaptive (see
+ *                PollUpdate), so only the slot mode is switched here
+ *                (PollModeSwitch), the firing alarm is never set or
+ *                cleared from its own callback.
+ *                An interrupt driven slot with more than adaptHigh
+ *                claimed/unknown interrupts in the window is switched to
+ *                polled mode. A polled slot with less than adaptLow
+ *                pending polls in the window is switched back.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *  Output.....: -
+ *  Globals....: -
+ ****************************************************************************/
+static void AdaptCheck( A201_BRD_STRUCT *a201Hdl )	/* nodoc */
+{
+	u_int32	i, cnt;
+
+	for( i=0; i<A201_NBR_OF_SLOTS; i++ ){
+		if( !a201Hdl->adaptive[i] || !a201Hdl->pollSig[i] )
+			continue;
+
+		if( !a201Hdl->pollMode[i] ){
+			cnt = a201Hdl->irqStats[i].irqYes + a201Hdl->irqStats[i].irqUnk;
+			if( cnt - a201Hdl->adaptMark[i] > a201Hdl->adaptHigh[i] ){
+				PollModeSwitch( a201Hdl, i, 1 );
+				a201Hdl->pollStats[i].switches++;
+				cnt = a201Hdl->pollStats[i].hits;
+			}
+		}
+		else {
+			cnt = a201Hdl->pollStats[i].hits;
+			if( cnt - a201Hdl->adaptMark[i] < a201Hdl->adaptLow[i] ){
+				PollModeSwitch( a201Hdl, i, 0 );
+				a201Hdl->pollStats[i].switches++;
+				cnt = a201Hdl->irqStats[i].irqYes +
+					  a201Hdl->irqStats[i].irqUnk;
+			}
+		}
+		a201Hdl->adaptMark[i] = cnt;
+	}
+}
+
+/********************************* AdaptSet *********************************
+ *
+ *  Description:  En/disables adaptive irq/poll switching of slot 'mSlot'
+ *
+ *                The slot starts (and stays after disabling) interrupt
+ *                driven.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *				 adaptive		0=off, 1=on
+ *  Output.....: return			error code
+ *  Globals....: -
+ ****************************************************************************/
+static int32 AdaptSet(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl,
+	u_int32 mSlot,
+	u_int32 adaptive )
+{
+	int32	error;
+
+	if( adaptive > 1 )
+		return ERR_BBIS_ILL_PARAM;
+
+	a201Hdl->adaptive[mSlot] = 0;
+	if( (error = PollModeSet( a201Hdl, mSlot, 0 )) )
+		return error;
+
+	a201Hdl->adaptMark[mSlot] = a201Hdl->irqStats[mSlot].irqYes +
+								a201Hdl->irqStats[mSlot].irqUnk;
+	a201Hdl->adaptive[mSlot]  = (u_int8)adaptive;
+
+	return PollUpdate( a201Hdl );
+}
+
+#ifdef A201_HRTIME
+/********************************* HistAdd **********************************
+ *
+ *  Description:  Counts 'value' in a log2 bucketed histogram
+ *
+ *                Bucket 0 counts 0, bucket n counts 2^(n-1)..2^n-1,
+ *                the last bucket counts all larger values.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: bucket			A201_HIST_BUCKETS buckets
+ *				 value			value to count
+ *  Output.....: -
+ *  Globals....: -
+ ****************************************************************************/
+static void HistAdd( u_int32 *bucket, u_int32 value )	/* nodoc */
+{
+	u_int32	n = 0;
+
+	while( value && n < A201_HIST_BUCKETS-1 ){
+		value >>= 1;
+		n++;
+	}
+	bucket[n]++;
+}
+
+/****************************** HistPercentile ******************************
+ *
+ *  Description:  Gets the upper bound of the bucket holding percentile 'pct'
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: bucket			A201_HIST_BUCKETS buckets
+ *				 pct			percentile 1..100
+ *  Output.....: return			upper bucket bound (0 if histogram empty,
+ *								0xffffffff for the last bucket)
+ *  Globals....: -
+ ****************************************************************************/
+static u_int32 HistPercentile( const u_int32 *bucket, u_int32 pct )	/* nodoc */
+{
+	u_int32	n, total = 0, sum = 0;
+
+	for( n=0; n<A201_HIST_BUCKETS; n++ )
+		total += bucket[n];
+
+	if( !total )
+		return 0;
+
+	for( n=0; n<A201_HIST_BUCKETS-1; n++ ){
+		sum += bucket[n];
+		/* sum/total >= pct/100 */
+		if( (u_int64)sum * 100 >= (u_int64)total * pct )
+			return (1UL << n) - 1;
+	}
+	return 0xffffffff;
+}
+#endif /* A201_HRTIME */
+
+#ifdef A201_IRQ_TRACE
+/********************************* IrqTrace *********************************
+ *
+ *  Description:  Records an event in the trace ring of slot 'mSlot'
+ *
+ *                Must only be called from the slot's interrupt path.
+ *                The oldest entries are overwritten if the ring is full.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *				 event			A201_TRC_xxx
+ *				 value			event specific value
+ *  Output.....: -
+ *  Globals....: -
+ ****************************************************************************/
+static void IrqTrace(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl,
+	u_int32 mSlot,
+	u_int8 event,
+	u_int16 value )
+{
+	u_int32				head = a201Hdl->trcHead[mSlot];
+	A201_TRACE_ENTRY	*ent = &a201Hdl->trc[mSlot][head & (A201_TRACE_SIZE-1)];
+
+	ent->stamp = A201_TIMESTAMP( a201Hdl );
+	ent->slot  = (u_int8)mSlot;
+	ent->event = event;
+	ent->value = value;
+
+	/* publish entry (entry must be visible before the new head) */
+	A201_MEM_BARRIER();
+	a201Hdl->trcHead[mSlot] = head + 1;
+}
+
+/******************************* IrqTraceDrain ******************************
+ *
+ *  Description:  Moves the recorded events of slot 'mSlot' to 'blk'
+ *
+ *                The block starts with an A201_TRACE_HDR, followed by
+ *                the entries. Entries overwritten by the interrupt path
+ *                before they could be copied are not returned; their
+ *                number since the last drain is returned in hdr.lost.
+ *
+ *---------------------------------------------------------------------------
+ *  Input......: a201Hdl		handle
+ *				 mSlot			module slot number
+ *				 blk			block getstat buffer
+ *  Output.....: blk->size		bytes returned (header and entries)
+ *				 return			error code
+ *  Globals....: -
+ ****************************************************************************/
+static int32 IrqTraceDrain(	/* nodoc */
+	A201_BRD_STRUCT *a201Hdl,
+	u_int32 mSlot,
+	M_SG_BLOCK *blk )
+{
+	A201_TRACE_HDR		*hdr = (A201_TRACE_HDR*)blk->data;
+	A201_TRACE_ENTRY	*dst = (A201_TRACE_ENTRY*)(hdr + 1);
+	u_int32	max, head, tail, n, i, skip;
+
+	if( blk->size < (int32)sizeof(A201_TRACE_HDR) )
+		return ERR_BBIS_ILL_PARAM;
+	max = (blk->size - sizeof(A201_TRACE_HDR)) / sizeof(A201_TRACE_ENTRY);
+
+	head = a201Hdl->trcHead[mSlot];
+	tail = a201Hdl->trcTail[mSlot];
+	A201_MEM_BARRIER();		/* entries up to head are complete */
+
+	/* ring overrun? */
+	if( head - tail > A201_TRACE_SIZE ){
+		a201Hdl->trcLost[mSlot] += head - tail - A201_TRACE_SIZE;
+		tail = head - A201_TRACE_SIZE;
+	}
+
+	n = head - tail;
+	if( n > max )
+		n = max;
+
+	for( i=0; i<n; i++ )
+		dst[i] = a201Hdl->trc[mSlot][(tail + i) & (A201_TRACE_SIZE-1)];
+
+	/*
+	 * drop entries overwritten while copying
+	 * (including the one the interrupt path may be writing at 'head')
+	 */
+	A201_MEM_BARRIER();
+	head = a201Hdl->trcHead[mSlot] + 1;
+	skip = 0;
+	if( head - tail > A201_TRACE_SIZE ){
+		skip = head - tail - A201_TRACE_SIZE;
+		if( skip > n )
+			skip = n;
+		a201Hdl->trcLost[mSlot] += skip;
+		for( i=skip; i<n; i++ )
+			dst[i-skip] = dst[i];
+	}
+
+	a201Hdl->trcTail[mSlot] = tail + n;
+
+	hdr->lost  = a201Hdl->trcLost[mSlot];
+	hdr->count = n - skip;
+	a201Hdl->trcLost[mSlot] = 0;
+	blk->size = sizeof(A201_TRACE_HDR) + hdr->count * sizeof(A201_TRACE_ENTRY);
+
+	return ERR_SUCCESS;
+}
+#endif /* A201_IRQ_TRACE */
+
 
 
 
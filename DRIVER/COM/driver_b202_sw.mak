@@ -33,6 +33,7 @@ MAK_LIBS=$(LIB_PREFIX)$(MEN_LIB_DIR)/desc$(LIB_SUFFIX)    \
          $(LIB_PREFIX)$(MEN_LIB_DIR)/id_sw$(LIB_SUFFIX)   \
 
 MAK_INCL=$(MEN_INC_DIR)/bb_a201.h     \
+         $(MEN_INC_DIR)/bb_a201_codes.h \
          $(MEN_INC_DIR)/men_typs.h    \
          $(MEN_INC_DIR)/oss.h         \
          $(MEN_INC_DIR)/mdis_err.h    \
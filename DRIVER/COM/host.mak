@@ -0,0 +1,90 @@
+#***************************  M a k e f i l e  *******************************
+#
+#    Description: host build of the A201 BBIS handler (GNU make)
+#
+#                 Links the unmodified bb_a201.c against the carrier model
+#                 and the OSS/DESC/DBG/id stubs in HOST/, for all six
+#                 variants of the driver*.mak files.
+#
+#                   make -f host.mak            build all variants
+#                   make -f host.mak check      run a201_host per variant
+#                   make -f host.mak bench      run a201_bench per variant
+#                                               (BENCH_LOOPS=n iterations)
+#                   make -f host.mak clean
+#
+#                 The bus cost model is set by the environment variables
+#                 A201M_D16_NS, A201M_D32_NS, A201M_IDPROM_ACC and
+#                 A201M_MAP_NS (see HOST/a201_model.c).
+#
+#-----------------------------------------------------------------------------
+#   Copyright 2026, MEN Mikro Elektronik GmbH
+#*****************************************************************************
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+CC       ?= gcc
+CFLAGS   ?= -O2 -g -Wall -Wextra
+OBJ_DIR  ?= host_obj
+
+# one entry per driver*.mak
+VARIANTS  = a201 a201_sw b201 b201_sw b202 b202_sw
+
+SW_a201    = -DA201=A201 -DA201_VARIANT=A201
+SW_a201_sw = -DA201=A201 -DA201_VARIANT=A201_SW -DMAC_BYTESWAP
+SW_b201    = -DB201=B201 -DA201_VARIANT=B201
+SW_b201_sw = -DB201=B201 -DA201_VARIANT=B201_SW -DMAC_BYTESWAP
+SW_b202    = -DB202=B202 -DA201_VARIANT=B202
+SW_b202_sw = -DB202=B202 -DA201_VARIANT=B202_SW -DMAC_BYTESWAP
+
+# handler switches of the host build (extra ones via HOST_SWITCH=...)
+HOST_SWITCH ?=
+MAK_SWITCH  = -DMAC_MEM_MAPPED -DMAK_REVISION=host -DA201_CTRL_HOOK \
+              -DA201_HRTIME -DA201_IRQ_TRACE -DA201_TASK_HOOK \
+              $(HOST_SWITCH)
+
+INCL = -IHOST -I../../INCLUDE/COM
+
+STUBS = HOST/a201_model.c HOST/oss_host.c HOST/desc_host.c HOST/dbg_host.c
+HDRS  = $(wildcard HOST/*.h HOST/MEN/*.h) ../../INCLUDE/COM/MEN/bb_a201_codes.h
+
+HOST_PROGS  = $(VARIANTS:%=$(OBJ_DIR)/a201_host_%)
+BENCH_PROGS = $(VARIANTS:%=$(OBJ_DIR)/a201_bench_%)
+BENCH_LOOPS ?= 2000
+
+.PHONY: all check bench clean
+
+all: $(HOST_PROGS) $(BENCH_PROGS)
+
+$(OBJ_DIR)/a201_host_%: bb_a201.c HOST/a201_host.c $(STUBS) $(HDRS)
+	@mkdir -p $(OBJ_DIR)
+	$(CC) $(CFLAGS) $(INCL) $(MAK_SWITCH) $(SW_$*) -o $@ \
+		bb_a201.c HOST/a201_host.c $(STUBS)
+
+# benchmark: handler with entry point counters (A201_PERF_CNT)
+$(OBJ_DIR)/a201_bench_%: bb_a201.c HOST/a201_bench.c $(STUBS) $(HDRS)
+	@mkdir -p $(OBJ_DIR)
+	$(CC) $(CFLAGS) $(INCL) $(MAK_SWITCH) -DA201_PERF_CNT $(SW_$*) -o $@ \
+		bb_a201.c HOST/a201_bench.c $(STUBS)
+
+check: $(HOST_PROGS)
+	@for v in $(VARIANTS); do \
+		echo "=== $$v"; $(OBJ_DIR)/a201_host_$$v || exit 1; \
+	done
+
+bench: $(BENCH_PROGS)
+	@for v in $(VARIANTS); do \
+		echo "=== $$v"; $(OBJ_DIR)/a201_bench_$$v $(BENCH_LOOPS) || exit 1; \
+	done
+
+clean:
+	rm -rf $(OBJ_DIR)
@@ -0,0 +1,306 @@
+/***********************  I n c l u d e  -  F i l e  ************************
+ *
+ *         Name: bb_a201_codes.h
+ *
+ *  Description: board specific SetStat/GetStat codes and data structures
+ *               of the A201/B201/B202 board handler
+ *
+ *     Switches: -
+ *
+ *---------------------------------------------------------------------------
+ * Copyright 2026, MEN Mikro Elektronik GmbH
+ ******************************************************************************/
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _BB_A201_CODES_H
+#define _BB_A201_CODES_H
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+/*-----------------------------------------+
+|  DEFINES                                 |
++-----------------------------------------*/
+/* entry point indices of A201_PERF */
+#define A201_PERF_INIT			0
+#define A201_PERF_BRDINIT		1
+#define A201_PERF_BRDEXIT		2
+#define A201_PERF_EXIT			3
+#define A201_PERF_CFGINFO		4
+#define A201_PERF_IRQENABLE		5
+#define A201_PERF_IRQSRVINIT	6
+#define A201_PERF_IRQSRVEXIT	7
+#define A201_PERF_SETMIFACE		8
+#define A201_PERF_CLRMIFACE		9
+#define A201_PERF_GETMADDR		10
+#define A201_PERF_SETSTAT		11
+#define A201_PERF_GETSTAT		12
+#define A201_PERF_ALARM			13	/* storm/poll alarm routines */
+#define A201_PERF_NBR			14	/* number of entries */
+
+/* interrupt trace (A201_IRQ_TRACE) */
+#define A201_TRACE_SIZE			64	/* entries per slot, power of 2 */
+#define A201_TRC_SRVINIT		1	/* A201_IrqSrvInit, value=BBIS_IRQ_xxx */
+#define A201_TRC_SRVEXIT		2	/* A201_IrqSrvExit */
+#define A201_TRC_STORM			3	/* slot masked by storm protection */
+
+/* max. number of slots (A201) */
+#define A201_MAX_SLOTS			4
+
+/* latency histograms: bucket 0 = 0, bucket n = 2^(n-1)..2^n-1 units of
+   the environment's clock (A201_IRQ_HIST.stampHz) */
+#define A201_HIST_BUCKETS		32
+
+/*
+ * binary board configuration record (descriptor key A201_CONFIG)
+ * All values are big endian.
+ *   offs  size
+ *   0     2     A201_CFG_MAGIC
+ *   2     1     A201_CFG_VERSION
+ *   3     1     number of slots of the board variant
+ *   4     2     record length (A201_CFG_SIZE)
+ *   6     2     checksum: sum of all bytes from offset 8 (16 bit)
+ *   8     4*n   A201_CFG_NBR_U32 values, see A201_CFG_xxx
+ *   ...   slots A201_CFG_NBR_ARR arrays of one byte per slot,
+ *               see A201_CFG_ARR_xxx
+ * The values have the meaning of the descriptor key of the same name.
+ */
+#define A201_CFG_MAGIC			0xa201
+#define A201_CFG_VERSION		1
+#define A201_CFG_HDR_SIZE		8
+
+#define A201_CFG_DEBUG_LEVEL	0	/* u_int32 values in record order */
+#define A201_CFG_PHYS_ADDR		1
+#define A201_CFG_VME_A24_ADDR	2
+#define A201_CFG_VME_A16_ADDR	3
+#define A201_CFG_VME_DATA_WIDTH	4
+#define A201_CFG_MAP_WHOLE_BOARD 5
+#define A201_CFG_MAP_LAZY		6
+#define A201_CFG_CTRL_ACCESS_D32 7
+#define A201_CFG_IRQ_SHARED		8
+#define A201_CFG_IRQ_PRIO_DISPATCH 9
+#define A201_CFG_IRQ_POLL_PERIOD 10
+#define A201_CFG_IRQ_ADAPT_HIGH	11
+#define A201_CFG_IRQ_ADAPT_LOW	12
+#define A201_CFG_IRQ_ADAPT_WINDOW 13
+#define A201_CFG_IRQ_STORM_LIMIT 14
+#define A201_CFG_IRQ_STORM_WINDOW 15
+#define A201_CFG_IRQ_STORM_HOLDOFF 16
+#define A201_CFG_NBR_U32		17
+
+#define A201_CFG_ARR_IRQ_VECTOR	0	/* slot arrays in record order */
+#define A201_CFG_ARR_IRQ_LEVEL	1
+#define A201_CFG_ARR_IRQ_PRIORITY 2
+#define A201_CFG_ARR_PNP_FORCE_FOUND 3
+#define A201_CFG_ARR_IRQ_PENDING_CHECK 4
+#define A201_CFG_ARR_IRQ_POLL	5
+#define A201_CFG_ARR_IRQ_ADAPTIVE 6
+#define A201_CFG_NBR_ARR		7
+
+#define A201_CFG_SIZE(slots) \
+	( A201_CFG_HDR_SIZE + 4 * A201_CFG_NBR_U32 + A201_CFG_NBR_ARR * (slots) )
+
+/* A201 specific A201_CfgInfo() codes */
+#define A201_CFGINFO_SLOT_ALL	0x8000		/* information of all slots    */
+#define A201_CFGINFO_VECT_SLOTS	0x8001		/* slots using an irq vector   */
+#define A201_CFGINFO_MAP_OPEN	0x8003		/* user mapping made (kernel)  */
+#define A201_CFGINFO_MAP_CLOSE	0x8004		/* user mapping gone (kernel)  */
+#define A201_CFGINFO_A08_CLAIM	0x8005		/* A08 window mapped (kernel)  */
+#define A201_CFGINFO_A08_RELEASE 0x8006		/* A08 window unmapped (kernel) */
+
+/* A201_MAP_INFO: mmap offsets (cookies) of the mappable regions */
+#define A201_MAP_OFFS_CTRL		0x00000		/* control registers slot 0 */
+#define A201_MAP_CTRL_STRIDE	0x01000		/* ... next slot */
+#define A201_MAP_OFFS_CTRL_SLOT(n) \
+	( A201_MAP_OFFS_CTRL + (n) * A201_MAP_CTRL_STRIDE )
+#define A201_MAP_OFFS_STATUS	0x10000		/* status page */
+
+/* A201 specific status codes (M_BRD_OF)           S,G: S=setstat, G=getstat */
+#define A201_PERF_RESET		M_BRD_OF+0x00	/* S: reset perf counters (1)  */
+#define A201_REG_RESYNC		M_BRD_OF+0x01	/* S: rewrite ctrl/vector regs */
+#define A201_PNP_INVALIDATE	M_BRD_OF+0x02	/* S: drop cached slot info    */
+#define A201_PNP_RESCAN		M_BRD_OF+0x03	/* S: probe slot again         */
+#define A201_PNP_SCAN		M_BRD_OF+0x04	/* S: start slot probe (mask)  */
+#define A201_IRQ_STATS_RESET	M_BRD_OF+0x05	/* S: clear irq statistics */
+#define A201_IRQ_COUNT		M_BRD_OF+0x06	/* G: interrupts seen          */
+#define A201_IRQ_CLAIMED	M_BRD_OF+0x07	/* G: interrupts claimed (YES) */
+#define A201_IRQ_UNKNOWN	M_BRD_OF+0x08	/* G: interrupts unknown (UNK) */
+#define A201_IRQ_TOGGLES	M_BRD_OF+0x09	/* G: irq enable/disable toggles */
+#define A201_IRQ_SRVTIME	M_BRD_OF+0x0a	/* G: SrvInit..SrvExit time (4) */
+#define A201_IRQ_HIST_RESET	M_BRD_OF+0x0b	/* S: clear latency hist. (4) */
+#define A201_IRQ_ENABLE_MASK	M_BRD_OF+0x0c	/* S: en/disable slots (3) */
+#define A201_IRQ_POLL		M_BRD_OF+0x0d	/* S,G: polled mode (0/1)      */
+#define A201_IRQ_ADAPTIVE	M_BRD_OF+0x0e	/* S,G: adaptive irq/poll (0/1) */
+#define A201_IRQ_ADAPT_HIGH	M_BRD_OF+0x0f	/* S,G: irqs/window to poll    */
+#define A201_IRQ_ADAPT_LOW	M_BRD_OF+0x10	/* S,G: hits/window to irq     */
+#define A201_IRQ_POLL_SIG	M_BRD_OF+0x11	/* S,G: poll signal (6)        */
+#define A201_SLOT_OCCUPIED	M_BRD_OF+0x13	/* G: fast occupancy check     */
+#define A201_PNP_WAIT		M_BRD_OF+0x14	/* S: wait for slot probe (5)  */
+
+/* A201 specific block status codes (M_BRD_BLK_OF) */
+#define A201_BLK_PERF		M_BRD_BLK_OF+0x00	/* G: perf counters (1)    */
+#define A201_BLK_PNP_INVENTORY	M_BRD_BLK_OF+0x01	/* G: slot inventory   */
+#define A201_BLK_IRQ_TRACE	M_BRD_BLK_OF+0x02	/* G: drain irq trace (2)  */
+#define A201_BLK_IRQ_STATS	M_BRD_BLK_OF+0x03	/* G: irq statistics       */
+#define A201_BLK_IRQ_HIST	M_BRD_BLK_OF+0x04	/* G: latency hist. (4)    */
+#define A201_BLK_POLL_STATS	M_BRD_BLK_OF+0x06	/* G: poll statistics      */
+#define A201_BLK_MAP_INFO	M_BRD_BLK_OF+0x07	/* G: register/status map  */
+#define A201_BLK_A08_INFO	M_BRD_BLK_OF+0x08	/* G: A08 window of slot   */
+
+/* (1) only supported if handler was built with A201_PERF_CNT */
+/* (2) only supported if handler was built with A201_IRQ_TRACE */
+/* (3) value: bit 15..8 slots to change, bit 7..0 enable (1) / disable (0);
+       all slots to change must have their interface set up, otherwise
+       no slot is changed */
+#define A201_IRQ_ENABLE_MASK_VAL(slots,enable) \
+	( (((slots) & 0xff) << 8) | ((enable) & 0xff) )
+/* (4) only supported if handler was built with A201_HRTIME, in units of
+       the environment's clock (A201_IRQ_STATS.stampHz) */
+/* (5) value: timeout (ms), -1=endless; waits for a running slot probe
+       (A201_PNP_SCAN or the ID-PROM prefetch of A201_BrdInit) */
+/* (6) value: signal sent to the calling process by each poll that finds
+       the slot's irq pending, 0=none; the process must clear the irq
+       source. Needs the slot interface, cleared by A201_ClrMIface. */
+
+/*-----------------------------------------+
+|  TYPEDEFS                                |
++-----------------------------------------*/
+/* A201_BLK_PERF: entry point counters */
+typedef struct
+{
+	u_int32	calls[A201_PERF_NBR];	/* number of calls */
+	u_int32	regAcc[A201_PERF_NBR];	/* control register accesses */
+	u_int32	allocs[A201_PERF_NBR];	/* memory allocations, mappings and
+									   alarms created */
+} A201_PERF;
+
+/* A201_BLK_IRQ_TRACE: block header, followed by 'count' entries */
+typedef struct
+{
+	u_int32	lost;					/* entries overwritten since the
+									   last drain (not returned) */
+	u_int32	count;					/* entries returned */
+} A201_TRACE_HDR;
+
+/* A201_BLK_IRQ_TRACE: one recorded event */
+typedef struct
+{
+	u_int32	stamp;					/* time stamp (ticks) */
+	u_int8	slot;					/* module slot */
+	u_int8	event;					/* A201_TRC_xxx */
+	u_int16	value;					/* event specific value */
+} A201_TRACE_ENTRY;
+
+/* A201_BLK_IRQ_STATS: interrupt statistics of one slot */
+typedef struct
+{
+	u_int32	irqCount;				/* A201_IrqSrvInit calls */
+	u_int32	irqYes;					/* claimed (BBIS_IRQ_YES) */
+	u_int32	irqNo;					/* not raised by slot (BBIS_IRQ_NO) */
+	u_int32	irqUnk;					/* unknown (BBIS_IRQ_UNK) */
+	u_int32	enables;				/* disabled->enabled toggles */
+	u_int32	disables;				/* enabled->disabled toggles */
+	u_int32	srvTime;				/* sum of SrvInit..SrvExit (stampHz
+									   units, A201_HRTIME only) */
+	u_int32	storms;					/* masked by storm protection */
+	u_int32	stampHz;				/* srvTime clock (Hz), 0=no A201_HRTIME */
+} A201_IRQ_STATS;
+
+/* A201_BLK_IRQ_HIST: latency histograms of one slot */
+typedef struct
+{
+	u_int32	srvTime[A201_HIST_BUCKETS];	/* A201_IrqSrvInit..A201_IrqSrvExit */
+	u_int32	enaDelay[A201_HIST_BUCKETS];	/* irq enable..first interrupt */
+	/* upper bucket bound of the 50/90/99% percentiles (set on read) */
+	u_int32	srvP50, srvP90, srvP99;
+	u_int32	enaP50, enaP90, enaP99;
+	u_int32	stampHz;				/* clock of all values (Hz, set on read) */
+} A201_IRQ_HIST;
+
+/* A201_BLK_POLL_STATS: poll statistics of one slot */
+typedef struct
+{
+	u_int32	polls;					/* pending bit checks */
+	u_int32	hits;					/* irq pending, signal sent */
+	u_int32	overruns;				/* late or overlapping polls */
+	u_int32	period;					/* granted poll period (ms) */
+	u_int32	rate;					/* achieved polls/s (set on read) */
+	u_int32	switches;				/* adaptive mode switches */
+} A201_POLL_STATS;
+
+/* A201_STATUS_PAGE: handler state of one slot */
+typedef struct
+{
+	u_int16	ctrl;					/* control register as written */
+	u_int16	vect;					/* vector register as written */
+	u_int8	irqEnabled;				/* irq enabled by driver */
+	u_int8	pollMode;				/* slot polled, irq kept off */
+	u_int8	stormHeld;				/* slot masked by storm holdoff */
+	u_int8	mifaceSet;				/* slot interface set up */
+} A201_STATUS_SLOT;
+
+/* A201_MAP_OFFS_STATUS: status page, maintained by the handler */
+typedef struct
+{
+	volatile u_int32 seq;			/* odd while an entry is updated */
+	u_int32	nbrOfSlots;				/* valid entries in slot[] */
+	A201_STATUS_SLOT slot[A201_MAX_SLOTS];
+} A201_STATUS_PAGE;
+
+/* A201_BLK_MAP_INFO: mappable regions, as the OS layer offers them */
+typedef struct
+{
+	u_int32	ctrlOffs;				/* mmap offset of slot 0 control regs */
+	u_int32	ctrlSize;				/* size of one slot's control regs */
+	u_int32	ctrlStride;				/* mmap offset between slots */
+	u_int32	nbrOfSlots;				/* number of slots */
+	u_int32	statusOffs;				/* mmap offset of status page */
+	u_int32	statusSize;				/* size of status page (whole pages) */
+} A201_MAP_INFO;
+
+/* A201_CFGINFO_MAP_OPEN/A08_CLAIM: region to map (kernel only) */
+typedef struct
+{
+	void	*addr;					/* control regs of one slot or A08
+									   window (local view) or status page
+									   (kernel address, page aligned) */
+	u_int32	size;					/* size of the region */
+	u_int32	addrSpace;				/* OSS_ADDRSPACE_xxx */
+	u_int32	readOnly;				/* map read only to user space */
+} A201_MAP_REGION;
+
+/* A201_BLK_A08_INFO: A08 window of one slot */
+typedef struct
+{
+	u_int32	size;					/* window size */
+	u_int32	mapCnt;					/* mappings of the claiming device */
+} A201_A08_INFO;
+
+/* A201_BLK_PNP_INVENTORY: one entry per slot (needs bb_defs.h) */
+typedef struct
+{
+	u_int32	occupied;				/* BBIS_SLOT_OCCUP_YES/NO */
+	u_int32	devId;					/* device id */
+	u_int32	devRev;					/* device revision */
+	char	devName[BBIS_SLOT_STR_MAXSIZE];	/* device name */
+} A201_SLOT_INFO;
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* _BB_A201_CODES_H */